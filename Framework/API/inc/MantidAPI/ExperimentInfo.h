@@ -10,6 +10,7 @@
 #include "MantidKernel/V3D.h"
 #include "MantidKernel/cow_ptr.h"
 
+#include <atomic>
 #include <list>
 #include <mutex>
 
@@ -37,6 +38,9 @@ class ModeratorModel;
 class Run;
 class Sample;
 class SpectrumInfo;
+namespace detail {
+struct SpectrumGeometryCache;
+}
 
 /** This class is shared by a few Workspace types
  * and holds information related to a particular experiment/run:
@@ -234,6 +238,14 @@ private:
   // This vector stores boolean flags but uses char to do so since
   // std::vector<bool> is not thread-safe.
   mutable std::vector<char> m_spectrumDefinitionNeedsUpdate;
+  /// L2 and 2 theta of all spectra, see SpectrumInfo::cacheGeometry().
+  mutable boost::shared_ptr<const detail::SpectrumGeometryCache>
+      m_spectrumGeometryCache;
+  /// Set when a spectrum definition is invalidated. Atomic since this can
+  /// happen concurrently for different spectra.
+  mutable std::atomic<bool> m_spectrumGeometryCacheOutdated{false};
+
+  friend class SpectrumInfo;
 };
 
 /// Shared pointer to ExperimentInfo
@@ -21,6 +21,7 @@ class DateAndTime;
 namespace Kernel {
 template <class KEYTYPE, class VALUETYPE> class Cache;
 template <typename TYPE> class TimeSeriesProperty;
+struct TimeSeriesPropertyStatistics;
 class SplittingInterval;
 using TimeSplitterType = std::vector<SplittingInterval>;
 class PropertyManager;
@@ -123,6 +124,8 @@ public:
   double getPropertyAsSingleValue(
       const std::string &name,
       Kernel::Math::StatisticType statistic = Kernel::Math::Mean) const;
+  /// Returns the time-weighted standard deviation of a numeric time series
+  double getTimeAveragedStd(const std::string &name) const;
   /// Returns a property as an integer value
   int getPropertyAsIntegerValue(const std::string &name) const;
   /// Returns the named property as a pointer
@@ -198,15 +201,25 @@ protected:
                  const std::map<std::string, std::string> &entries);
   /// A pointer to a property manager
   std::unique_ptr<Kernel::PropertyManager> m_manager;
+  /// Forget all cached statistics after the logs have been modified
+  void clearStatisticsCache();
   /// Name of the log entry containing the proton charge when retrieved using
   /// getProtonCharge
   static const char *PROTON_CHARGE_LOG_NAME;
 
 private:
+  /// Get the (cached) statistics of a numeric time series log
+  bool
+  getTimeSeriesStatistics(const Kernel::Property *log,
+                          Kernel::TimeSeriesPropertyStatistics &stats) const;
   /// Cache for the retrieved single values
   std::unique_ptr<Kernel::Cache<
       std::pair<std::string, Kernel::Math::StatisticType>, double>>
       m_singleValueCache;
+  /// Cache for the full statistics of numeric time series logs
+  std::unique_ptr<
+      Kernel::Cache<std::string, Kernel::TimeSeriesPropertyStatistics>>
+      m_statisticsCache;
 };
 /// shared pointer to the logManager base class
 using LogManager_sptr = boost::shared_ptr<LogManager>;
@@ -432,6 +432,9 @@ public:
   /// Returns true if the workspace contains has common X bins
   virtual bool isCommonBins() const;
 
+  /// Make spectra with identical X values share a single copy of them
+  void shareIdenticalX();
+
   std::string YUnit() const;
   void setYUnit(const std::string &newUnit);
   std::string YUnitLabel() const;
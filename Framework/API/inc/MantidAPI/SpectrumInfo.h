@@ -24,6 +24,9 @@ class ParameterMap;
 namespace API {
 class SpectrumInfoIterator;
 class ExperimentInfo;
+namespace detail {
+struct SpectrumGeometryCache;
+}
 
 /** API::SpectrumInfo is an intermediate step towards a SpectrumInfo that is
   part of Instrument-2.0. The aim is to provide a nearly identical interface
@@ -34,10 +37,15 @@ class ExperimentInfo;
   spectra (which may correspond to one or more detectors), such as mask and
   monitor flags, L1, L2, and 2-theta.
 
+  L2 and 2-theta of all spectra can be precomputed with cacheGeometry(). The
+  cache is stored in the owning ExperimentInfo, is carried over to copies of it,
+  and is ignored once detector positions or spectrum definitions change.
+
   This class is thread safe for read operations (const access) with OpenMP BUT
   NOT WITH ANY OTHER THREADING LIBRARY such as Poco threads or Intel TBB. There
   are no thread-safety guarantees for write operations (non-const access). Reads
-  concurrent with writes or concurrent writes are not allowed.
+  concurrent with writes or concurrent writes are not allowed. This includes
+  cacheGeometry(), which is a write operation.
 
 
   @author Simon Heybrock
@@ -99,6 +107,8 @@ public:
   Kernel::V3D samplePosition() const;
   double l1() const;
 
+  void cacheGeometry();
+
   SpectrumInfoIterator begin() const;
   SpectrumInfoIterator end() const;
 
@@ -108,6 +118,7 @@ private:
   const Geometry::IDetector &getDetector(const size_t index) const;
   const SpectrumDefinition &
   checkAndGetSpectrumDefinition(const size_t index) const;
+  const detail::SpectrumGeometryCache *geometryCache() const;
 
   const ExperimentInfo &m_experimentInfo;
   Geometry::DetectorInfo &m_detectorInfo;
@@ -8,9 +8,12 @@
 #ifndef Q_MOC_RUN
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/shared_ptr.hpp>
+#include <memory>
 #include <unordered_map>
 #endif
 
+class ANNkd_tree;
+
 namespace Mantid {
 namespace Geometry {
 class Instrument;
@@ -32,6 +35,11 @@ class SpectrumInfo;
  * ANN is available from <http://www.cs.umd.edu/~mount/ANN/> and is released
  * under the GNU LGPL.
  *
+ * The kd-tree is built once on construction and kept for the lifetime of the
+ * object. Radius queries are answered directly by a fixed-radius search of the
+ * tree, while the k-nearest graph is only recomputed when a different number
+ * of neighbours is requested.
+ *
  * Known potential issue: boost's graph has an issue that may cause compilation
  * errors in some circumstances in the current version of boost used by
  * Mantid (1.43) based on tr1::tie. This issue is fixed in later versions
@@ -64,6 +72,7 @@ public:
   WorkspaceNearestNeighbours(int nNeighbours, const SpectrumInfo &spectrumInfo,
                              std::vector<specnum_t> spectrumNumbers,
                              bool ignoreMaskedDetectors = false);
+  ~WorkspaceNearestNeighbours();
 
   // Neighbouring spectra by radius
   std::map<specnum_t, Mantid::Kernel::V3D>
@@ -91,8 +100,10 @@ private:
   /// map object of int to Graph Vertex descriptor
   using MapIV = std::unordered_map<specnum_t, Vertex>;
 
-  /// Construct the graph based on the given number of neighbours and the
-  /// current instument and spectra-detector mapping
+  /// Construct the kd-tree from the current instrument and spectra-detector
+  /// mapping
+  void buildTree();
+  /// Construct the graph based on the given number of neighbours
   void build(const int noNeighbours);
   /// Query the graph for the default number of nearest neighbours to specified
   /// detector
@@ -100,8 +111,6 @@ private:
   defaultNeighbours(const specnum_t spectrum) const;
   /// The current number of nearest neighbours
   int m_noNeighbours;
-  /// The largest value of the distance to a nearest neighbour
-  double m_cutoff;
   /// map between the DetectorID and the Graph node descriptor
   MapIV m_specToVertex;
   /// boost::graph object
@@ -112,8 +121,14 @@ private:
   boost::property_map<Graph, boost::edge_name_t>::type m_edgeLength;
   /// V3D for scaling
   Kernel::V3D m_scale;
-  /// Cached radius value. used to avoid uncessary recalculations.
-  mutable double m_radius;
+  /// Scaled detector positions, three coordinates per point
+  std::vector<double> m_scaledPositions;
+  /// Pointers into m_scaledPositions in the layout expected by ANN
+  std::vector<double *> m_points;
+  /// Spectrum number of each point in the tree
+  std::vector<specnum_t> m_pointSpectra;
+  /// The kd-tree over the scaled detector positions
+  std::unique_ptr<ANNkd_tree> m_annTree;
   /// Flag indicating that masked detectors should be ignored
   bool m_bIgnoreMaskedDetectors;
 };
@@ -79,6 +79,10 @@ ExperimentInfo::ExperimentInfo()
 ExperimentInfo::ExperimentInfo(const ExperimentInfo &source) {
   this->copyExperimentInfoFrom(&source);
   setSpectrumDefinitions(source.spectrumInfo().sharedSpectrumDefinitions());
+  // Geometry and spectrum definitions are identical, so the copy can share the
+  // cached spectrum geometry.
+  if (!source.m_spectrumGeometryCacheOutdated)
+    m_spectrumGeometryCache = source.m_spectrumGeometryCache;
 }
 
 // Defined as default in source for forward declaration with std::unique_ptr.
@@ -188,6 +192,7 @@ void checkDetectorInfoSize(const Instrument &instr,
  */
 void ExperimentInfo::setInstrument(const Instrument_const_sptr &instr) {
   m_spectrumInfoWrapper = nullptr;
+  m_spectrumGeometryCache = nullptr;
 
   // Detector IDs that were previously dropped because they were not part of the
   // instrument may now suddenly be valid, so we have to reinitialize the
@@ -483,6 +488,7 @@ void ExperimentInfo::setNumberOfDetectorGroups(const size_t count) const {
   m_spectrumDefinitionNeedsUpdate.resize(count, 1);
   m_spectrumInfo = Kernel::make_unique<Beamline::SpectrumInfo>(count);
   m_spectrumInfoWrapper = nullptr;
+  m_spectrumGeometryCache = nullptr;
 }
 
 /** Returns the number of detector groups.
@@ -510,6 +516,7 @@ void ExperimentInfo::setDetectorGrouping(
   }
   m_spectrumInfo->setSpectrumDefinition(index, std::move(specDef));
   m_spectrumDefinitionNeedsUpdate.at(index) = 0;
+  m_spectrumGeometryCacheOutdated = true;
 }
 
 /** Update detector grouping for spectrum with given index.
@@ -1127,6 +1134,7 @@ void ExperimentInfo::setSpectrumDefinitions(
     invalidateAllSpectrumDefinitions();
   }
   m_spectrumInfoWrapper = nullptr;
+  m_spectrumGeometryCache = nullptr;
 }
 
 /** Notifies the ExperimentInfo that a spectrum definition has changed.
@@ -1138,6 +1146,7 @@ void ExperimentInfo::invalidateSpectrumDefinition(const size_t index) {
   // This uses a vector of char, such that flags for different indices can be
   // set from different threads (std::vector<bool> is not thread-safe).
   m_spectrumDefinitionNeedsUpdate.at(index) = 1;
+  m_spectrumGeometryCacheOutdated = true;
 }
 
 void ExperimentInfo::updateSpectrumDefinitionIfNecessary(
@@ -1191,6 +1200,7 @@ size_t ExperimentInfo::groupOfDetectorID(const detid_t detID) const {
 void ExperimentInfo::invalidateAllSpectrumDefinitions() {
   std::fill(m_spectrumDefinitionNeedsUpdate.begin(),
             m_spectrumDefinitionNeedsUpdate.end(), 1);
+  m_spectrumGeometryCache = nullptr;
 }
 
 /** Save the object to an open NeXus file.
@@ -71,6 +71,29 @@ bool convertPropertyToDouble(const Property *property, double &value,
          convertTimeSeriesToDouble<T>(property, value, function);
 }
 
+/// Templated method to get the statistics of a time series property
+template <typename T>
+bool timeSeriesStatistics(const Property *property,
+                          TimeSeriesPropertyStatistics &stats) {
+  if (const auto *log = dynamic_cast<const TimeSeriesProperty<T> *>(property)) {
+    stats = log->getStatistics();
+    return true;
+  } else {
+    return false;
+  }
+}
+
+/// Gets the statistics of a numeric time series property
+bool timeSeriesStatistics(const Property *property,
+                          TimeSeriesPropertyStatistics &stats) {
+  return timeSeriesStatistics<double>(property, stats) ||
+         timeSeriesStatistics<int32_t>(property, stats) ||
+         timeSeriesStatistics<int64_t>(property, stats) ||
+         timeSeriesStatistics<uint32_t>(property, stats) ||
+         timeSeriesStatistics<uint64_t>(property, stats) ||
+         timeSeriesStatistics<float>(property, stats);
+}
+
 /// Converts a property to a single double
 bool convertPropertyToDouble(const Property *property, double &value,
                              const Math::StatisticType &function) {
@@ -98,15 +121,21 @@ LogManager::LogManager()
     : m_manager(Kernel::make_unique<Kernel::PropertyManager>()),
       m_singleValueCache(
           Kernel::make_unique<Kernel::Cache<
-              std::pair<std::string, Kernel::Math::StatisticType>, double>>()) {
-}
+              std::pair<std::string, Kernel::Math::StatisticType>, double>>()),
+      m_statisticsCache(
+          Kernel::make_unique<
+              Kernel::Cache<std::string, TimeSeriesPropertyStatistics>>()) {}
 
 LogManager::LogManager(const LogManager &other)
     : m_manager(Kernel::make_unique<Kernel::PropertyManager>(*other.m_manager)),
       m_singleValueCache(
           Kernel::make_unique<Kernel::Cache<
               std::pair<std::string, Kernel::Math::StatisticType>, double>>(
-              *other.m_singleValueCache)) {}
+              *other.m_singleValueCache)),
+      m_statisticsCache(
+          Kernel::make_unique<
+              Kernel::Cache<std::string, TimeSeriesPropertyStatistics>>(
+              *other.m_statisticsCache)) {}
 
 // Defined as default in source for forward declaration with std::unique_ptr.
 LogManager::~LogManager() = default;
@@ -116,6 +145,9 @@ LogManager &LogManager::operator=(const LogManager &other) {
   m_singleValueCache = Kernel::make_unique<Kernel::Cache<
       std::pair<std::string, Kernel::Math::StatisticType>, double>>(
       *other.m_singleValueCache);
+  m_statisticsCache = Kernel::make_unique<
+      Kernel::Cache<std::string, TimeSeriesPropertyStatistics>>(
+      *other.m_statisticsCache);
   return *this;
 }
 
@@ -204,6 +236,7 @@ void LogManager::filterByTime(const Types::Core::DateAndTime start,
                               const Types::Core::DateAndTime stop) {
   // The propery manager operator will make all timeseriesproperties filter.
   m_manager->filterByTime(start, stop);
+  clearStatisticsCache();
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -222,6 +255,7 @@ void LogManager::splitByTime(TimeSplitterType &splitter,
   for (size_t i = 0; i < n; i++) {
     if (outputs[i]) {
       output_managers[i] = outputs[i]->m_manager.get();
+      outputs[i]->clearStatisticsCache();
     }
   }
 
@@ -237,7 +271,7 @@ void LogManager::splitByTime(TimeSplitterType &splitter,
  */
 void LogManager::filterByLog(const Kernel::TimeSeriesProperty<bool> &filter) {
   // This will invalidate the cache
-  m_singleValueCache->clear();
+  clearStatisticsCache();
   m_manager->filterByProperty(filter);
 }
 
@@ -284,11 +318,15 @@ bool LogManager::hasProperty(const std::string &name) const {
  */
 
 void LogManager::removeProperty(const std::string &name, bool delProperty) {
-  // Remove any cached entries for this log. Need to make this more general
-  for (unsigned int stat = 0; stat < 7; ++stat) {
+  // Remove any cached entries for this log
+  for (unsigned int stat = Math::FirstValue; stat <= Math::Median; ++stat) {
     m_singleValueCache->removeCache(
         std::make_pair(name, static_cast<Math::StatisticType>(stat)));
   }
+  // Names are looked up regardless of case, the statistics are cached under
+  // the name of the log itself
+  if (hasProperty(name))
+    m_statisticsCache->removeCache(getProperty(name)->name());
   m_manager->removeProperty(name, delProperty);
 }
 
@@ -365,7 +403,12 @@ double LogManager::getPropertyAsSingleValue(
   const auto key = std::make_pair(name, statistic);
   if (!m_singleValueCache->getCache(key, singleValue)) {
     const Property *log = getProperty(name);
-    if (!convertPropertyToDouble(log, singleValue, statistic)) {
+    TimeSeriesPropertyStatistics stats;
+    // Mean and median share one pass over the values of a time series
+    if ((statistic == Math::Mean || statistic == Math::Median) &&
+        getTimeSeriesStatistics(log, stats)) {
+      singleValue = (statistic == Math::Mean) ? stats.mean : stats.median;
+    } else if (!convertPropertyToDouble(log, singleValue, statistic)) {
       if (const auto stringLog =
               dynamic_cast<const PropertyWithValue<std::string> *>(log)) {
         // Try to lexically cast string to a double
@@ -388,6 +431,22 @@ double LogManager::getPropertyAsSingleValue(
   return singleValue;
 }
 
+/**
+ * Returns the time-weighted standard deviation of a numeric time series log.
+ * The statistics of the log are cached until it is modified through this
+ * object.
+ * @param name :: The name of the property
+ * @return The time-weighted standard deviation
+ */
+double LogManager::getTimeAveragedStd(const std::string &name) const {
+  TimeSeriesPropertyStatistics stats;
+  if (!getTimeSeriesStatistics(getProperty(name), stats)) {
+    throw std::invalid_argument("Run::getTimeAveragedStd - Property \"" +
+                                name + "\" is not a numeric time series.");
+  }
+  return stats.time_standard_deviation;
+}
+
 /**
  * Returns a property as a n integer, if the underlying value is an integer.
  * Throws otherwise.
@@ -432,6 +491,7 @@ Kernel::Property *LogManager::getProperty(const std::string &name) const {
  *  PropertyManager to limit its visibility to Run clients.
  */
 void LogManager::clearTimeSeriesLogs() {
+  clearStatisticsCache();
   auto &props = getProperties();
 
   // Loop over the set of properties, identifying those that are time-series
@@ -449,6 +509,7 @@ void LogManager::clearTimeSeriesLogs() {
  *  the definition of 'last entry'.
  */
 void LogManager::clearOutdatedTimeSeriesLogValues() {
+  clearStatisticsCache();
   auto &props = getProperties();
   for (auto prop : props) {
     if (auto tsp = dynamic_cast<ITimeSeriesProperty *>(prop)) {
@@ -521,7 +582,7 @@ void LogManager::loadNexus(::NeXus::File *file,
       auto prop = PropertyNexus::loadProperty(file, name_class.first);
       if (prop) {
         if (m_manager->existsProperty(prop->name())) {
-          m_manager->removeProperty(prop->name());
+          removeProperty(prop->name());
         }
         m_manager->declareProperty(std::move(prop));
       }
@@ -532,12 +593,41 @@ void LogManager::loadNexus(::NeXus::File *file,
 /**
  * Clear the logs.
  */
-void LogManager::clearLogs() { m_manager->clear(); }
+void LogManager::clearLogs() {
+  clearStatisticsCache();
+  m_manager->clear();
+}
+
+/**
+ * Forget all cached single values and statistics. Call this after modifying
+ * the logs in place.
+ */
+void LogManager::clearStatisticsCache() {
+  m_singleValueCache->clear();
+  m_statisticsCache->clear();
+}
 
 //-----------------------------------------------------------------------------------------------------------------------
 // Private methods
 //-----------------------------------------------------------------------------------------------------------------------
 
+/**
+ * Get the statistics of a numeric time series log, computing them only on the
+ * first request.
+ * @param log :: The log to get the statistics of
+ * @param stats :: Output statistics
+ * @return False if the log is not a numeric time series
+ */
+bool LogManager::getTimeSeriesStatistics(
+    const Property *log, TimeSeriesPropertyStatistics &stats) const {
+  if (m_statisticsCache->getCache(log->name(), stats))
+    return true;
+  if (!timeSeriesStatistics(log, stats))
+    return false;
+  m_statisticsCache->setCache(log->name(), stats);
+  return true;
+}
+
 /** @cond */
 /// Macro to instantiate concrete template members
 #define INSTANTIATE(TYPE)                                                      \
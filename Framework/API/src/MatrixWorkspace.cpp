@@ -25,10 +25,14 @@
 #include "MantidParallel/Communicator.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
 #include <cmath>
 
 #include <functional>
 #include <numeric>
+#include <unordered_map>
 
 using Mantid::Kernel::TimeSeriesProperty;
 using Mantid::Types::Core::DateAndTime;
@@ -1000,6 +1004,51 @@ bool MatrixWorkspace::isCommonBins() const {
   return m_isCommonBinsFlag;
 }
 
+/**
+ * Makes all spectra whose X values are identical share a single copy of them.
+ * Distinct X arrays are interned in a registry keyed by a hash of their
+ * values, so that a workspace with many spectra but few distinct binnings
+ * holds only one X array per binning. If afterwards all spectra share the
+ * same X array the common bins flag is set directly.
+ */
+void MatrixWorkspace::shareIdenticalX() {
+  const size_t numHist = getNumberHistograms();
+  if (numHist == 0)
+    return;
+
+  std::vector<size_t> hashes(numHist);
+  PARALLEL_FOR_IF(this->threadSafe())
+  for (int64_t i = 0; i < static_cast<int64_t>(numHist); ++i) {
+    const auto &xValues = x(static_cast<size_t>(i));
+    hashes[i] = boost::hash_range(xValues.cbegin(), xValues.cend());
+  }
+
+  using XPtr = Kernel::cow_ptr<HistogramData::HistogramX>;
+  std::unordered_map<size_t, std::vector<XPtr>> registry;
+  size_t distinctCount = 0;
+  for (size_t i = 0; i < numHist; ++i) {
+    auto &candidates = registry[hashes[i]];
+    const auto &xValues = x(i);
+    const auto match =
+        std::find_if(candidates.cbegin(), candidates.cend(),
+                     [&xValues](const XPtr &candidate) {
+                       return &(*candidate) == &xValues ||
+                              candidate->rawData() == xValues.rawData();
+                     });
+    if (match == candidates.cend()) {
+      candidates.push_back(sharedX(i));
+      ++distinctCount;
+    } else if (&(**match) != &xValues) {
+      setSharedX(i, *match);
+    }
+  }
+
+  if (distinctCount == 1) {
+    m_isCommonBinsFlag = true;
+    m_isCommonBinsFlagSet = true;
+  }
+}
+
 /** Called by the algorithm MaskBins to mask a single bin for the first time,
  * algorithms that later propagate the
  *  the mask from an input to the output should call flagMasked() instead. Here
@@ -95,6 +95,8 @@ void Run::filterByTime(const Types::Core::DateAndTime start,
  * @returns A reference to the summed object
  */
 Run &Run::operator+=(const Run &rhs) {
+  // The logs are changed in place so the cached statistics are stale
+  clearStatisticsCache();
   // merge and copy properties where there is no risk of corrupting data
   mergeMergables(*m_manager, *rhs.m_manager);
 
@@ -2,18 +2,34 @@
 #include "MantidAPI/ExperimentInfo.h"
 #include "MantidAPI/SpectrumInfoIterator.h"
 #include "MantidBeamline/SpectrumInfo.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <algorithm>
 #include <boost/make_shared.hpp>
+#include <cmath>
+#include <limits>
 
 namespace Mantid {
 namespace API {
 
+namespace detail {
+/// Per-spectrum geometry computed by SpectrumInfo::cacheGeometry(). Entries
+/// that could not be computed, e.g., 2 theta of monitors, are NaN.
+struct SpectrumGeometryCache {
+  uint64_t detectorRevision;
+  uint64_t componentRevision;
+  std::vector<double> l2;
+  std::vector<double> twoTheta;
+  std::vector<double> signedTwoTheta;
+};
+} // namespace detail
+
 SpectrumInfo::SpectrumInfo(const Beamline::SpectrumInfo &spectrumInfo,
                            const ExperimentInfo &experimentInfo,
                            Geometry::DetectorInfo &detectorInfo)
@@ -63,6 +79,10 @@ bool SpectrumInfo::isMasked(const size_t index) const {
  * i.e., for a monitor in the beamline between source and sample L2 is negative.
  */
 double SpectrumInfo::l2(const size_t index) const {
+  if (const auto cache = geometryCache()) {
+    if (!std::isnan(cache->l2[index]))
+      return cache->l2[index];
+  }
   double l2{0.0};
   for (const auto &detIndex : checkAndGetSpectrumDefinition(index))
     l2 += m_detectorInfo.l2(detIndex);
@@ -75,6 +95,10 @@ double SpectrumInfo::l2(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::twoTheta(const size_t index) const {
+  if (const auto cache = geometryCache()) {
+    if (!std::isnan(cache->twoTheta[index]))
+      return cache->twoTheta[index];
+  }
   double twoTheta{0.0};
   for (const auto &detIndex : checkAndGetSpectrumDefinition(index))
     twoTheta += m_detectorInfo.twoTheta(detIndex);
@@ -87,6 +111,10 @@ double SpectrumInfo::twoTheta(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::signedTwoTheta(const size_t index) const {
+  if (const auto cache = geometryCache()) {
+    if (!std::isnan(cache->signedTwoTheta[index]))
+      return cache->signedTwoTheta[index];
+  }
   double signedTwoTheta{0.0};
   for (const auto &detIndex : checkAndGetSpectrumDefinition(index))
     signedTwoTheta += m_detectorInfo.signedTwoTheta(detIndex);
@@ -142,6 +170,47 @@ Kernel::V3D SpectrumInfo::samplePosition() const {
 /// Returns L1 (distance from source to sample).
 double SpectrumInfo::l1() const { return m_detectorInfo.l1(); }
 
+/** Computes L2, 2 theta and signed 2 theta of all spectra and caches them.
+ *
+ * Subsequent calls to l2(), twoTheta() and signedTwoTheta() return the cached
+ * values as long as the instrument geometry and the spectrum definitions are
+ * unchanged, otherwise they fall back to computing the values from the
+ * detector positions. Not thread safe. */
+void SpectrumInfo::cacheGeometry() {
+  if (geometryCache())
+    return;
+  auto &componentInfo = m_experimentInfo.m_parmap->mutableComponentInfo();
+  m_detectorInfo.updateGeometryRevision();
+  componentInfo.updateGeometryRevision();
+
+  // Drop any outdated cache such that values below are computed directly
+  m_experimentInfo.m_spectrumGeometryCache = nullptr;
+  auto cache = boost::make_shared<detail::SpectrumGeometryCache>();
+  cache->detectorRevision = m_detectorInfo.geometryRevision();
+  cache->componentRevision = componentInfo.geometryRevision();
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  cache->l2.resize(size(), nan);
+  cache->twoTheta.resize(size(), nan);
+  cache->signedTwoTheta.resize(size(), nan);
+
+  const auto numberOfSpectra = static_cast<int64_t>(size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    if (!hasDetectors(i))
+      continue;
+    // Values that cannot be computed are left as NaN, such that accessing them
+    // later throws the same exception as without the cache.
+    try {
+      cache->l2[i] = l2(i);
+      cache->twoTheta[i] = twoTheta(i);
+      cache->signedTwoTheta[i] = signedTwoTheta(i);
+    } catch (std::exception &) {
+    }
+  }
+  m_experimentInfo.m_spectrumGeometryCacheOutdated = false;
+  m_experimentInfo.m_spectrumGeometryCache = std::move(cache);
+}
+
 const Geometry::IDetector &SpectrumInfo::getDetector(const size_t index) const {
   size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
   if (m_lastIndex[thread] == index)
@@ -183,6 +252,18 @@ SpectrumInfo::checkAndGetSpectrumDefinition(const size_t index) const {
   return spectrumDefinition(index);
 }
 
+/// Returns the geometry cache if it is up to date, nullptr otherwise.
+const detail::SpectrumGeometryCache *SpectrumInfo::geometryCache() const {
+  const auto &cache = m_experimentInfo.m_spectrumGeometryCache;
+  if (!cache || m_experimentInfo.m_spectrumGeometryCacheOutdated)
+    return nullptr;
+  if (cache->detectorRevision != m_detectorInfo.geometryRevision() ||
+      cache->componentRevision !=
+          m_experimentInfo.componentInfo().geometryRevision())
+    return nullptr;
+  return cache.get();
+}
+
 // Begin method for iterator
 SpectrumInfoIterator SpectrumInfo::begin() const {
   return SpectrumInfoIterator(*this, 0);
@@ -7,6 +7,10 @@
 #include "MantidKernel/ANN/ANN.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Timer.h"
+#include "MantidKernel/make_unique.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Mantid {
 using namespace Geometry;
@@ -29,11 +33,15 @@ WorkspaceNearestNeighbours::WorkspaceNearestNeighbours(
     std::vector<specnum_t> spectrumNumbers, bool ignoreMaskedDetectors)
     : m_spectrumInfo(spectrumInfo),
       m_spectrumNumbers(std::move(spectrumNumbers)),
-      m_noNeighbours(nNeighbours), m_cutoff(-DBL_MAX), m_radius(0),
+      m_noNeighbours(nNeighbours),
       m_bIgnoreMaskedDetectors(ignoreMaskedDetectors) {
+  this->buildTree();
   this->build(m_noNeighbours);
 }
 
+// Defined as default in source for forward declaration with std::unique_ptr.
+WorkspaceNearestNeighbours::~WorkspaceNearestNeighbours() = default;
+
 /**
  * Returns a map of the spectrum numbers to the distances for the nearest
  * neighbours.
@@ -62,7 +70,6 @@ WorkspaceNearestNeighbours::neighboursInRadius(const specnum_t spectrum,
         "NearestNeighbours::neighbours - Invalid radius parameter.");
   }
 
-  std::map<specnum_t, V3D> result;
   if (radius == 0.0) {
     const int eightNearest = 8;
     if (m_noNeighbours != eightNearest) {
@@ -72,29 +79,39 @@ WorkspaceNearestNeighbours::neighboursInRadius(const specnum_t spectrum,
       // Cast is necessary as the user should see this as a const member
       const_cast<WorkspaceNearestNeighbours *>(this)->build(eightNearest);
     }
-    result = defaultNeighbours(spectrum);
-  } else if (radius > m_cutoff && m_radius != radius) {
-    // We might have to see how efficient this ends up being.
-    int neighbours = m_noNeighbours + 1;
-    while (true) {
-      try {
-        const_cast<WorkspaceNearestNeighbours *>(this)->build(neighbours);
-      } catch (std::invalid_argument &) {
-        break;
-      }
-      if (radius < m_cutoff)
-        break;
-      else
-        neighbours += 1;
-    }
+    return defaultNeighbours(spectrum);
+  }
+
+  auto vertex = m_specToVertex.find(spectrum);
+  if (vertex == m_specToVertex.end()) {
+    throw Mantid::Kernel::Exception::NotFoundError(
+        "NearestNeighbours: Unable to find spectrum in vertex map", spectrum);
   }
-  m_radius = radius;
+  // Vertices are added in point order so the descriptor is the point number
+  ANNpoint scaledPos = m_points[vertex->second];
+
+  // The scaling differs per axis, so a sphere of the requested radius in real
+  // space lies within a sphere of radius / (smallest scale) in the scaled
+  // space. The candidates are then filtered on their real-space distance.
+  const double minScale = std::min(
+      {std::abs(m_scale.X()), std::abs(m_scale.Y()), std::abs(m_scale.Z())});
+  const double scaledRadius = radius / minScale;
+  const ANNdist sqRadius = scaledRadius * scaledRadius;
+  // A first search with k = 0 only counts the points in range
+  const int nInRange =
+      m_annTree->annkFRSearch(scaledPos, sqRadius, 0, nullptr, nullptr);
+  std::vector<ANNidx> nnIndexList(nInRange);
+  std::vector<ANNdist> nnDistList(nInRange);
+  m_annTree->annkFRSearch(scaledPos, sqRadius, nInRange, nnIndexList.data(),
+                          nnDistList.data());
 
-  std::map<detid_t, V3D> nearest = defaultNeighbours(spectrum);
-  for (std::map<specnum_t, V3D>::const_iterator cit = nearest.begin();
-       cit != nearest.end(); ++cit) {
-    if (cit->second.norm() <= radius) {
-      result[cit->first] = cit->second;
+  std::map<specnum_t, V3D> result;
+  const V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
+  for (const auto index : nnIndexList) {
+    const ANNpoint point = m_points[index];
+    const V3D distance = V3D(point[0], point[1], point[2]) * m_scale - realPos;
+    if (distance.norm() <= radius) {
+      result[m_pointSpectra[index]] = distance;
     }
   }
   return result;
@@ -104,11 +121,10 @@ WorkspaceNearestNeighbours::neighboursInRadius(const specnum_t spectrum,
 // Private member functions
 //--------------------------------------------------------------------------
 /**
- * Builds a map based on the given number of neighbours
- * @param noNeighbours :: The number of nearest neighbours to use to build
- * the graph
+ * Builds the kd-tree over the scaled positions of the valid spectra. The tree
+ * is kept for the lifetime of the object and shared by all queries.
  */
-void WorkspaceNearestNeighbours::build(const int noNeighbours) {
+void WorkspaceNearestNeighbours::buildTree() {
   const auto indices = getSpectraDetectors();
   if (indices.empty()) {
     throw std::runtime_error(
@@ -116,6 +132,38 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   }
   const int nspectra =
       static_cast<int>(indices.size()); // ANN only deals with integers
+
+  BoundingBox bbox;
+  // Base the scaling on the first detector, should be adequate but we can look
+  // at this
+  const auto &firstDet = m_spectrumInfo.detector(indices.front());
+  firstDet.getBoundingBox(bbox);
+  m_scale = V3D(bbox.width());
+
+  m_scaledPositions.resize(3 * indices.size());
+  m_points.resize(indices.size());
+  m_pointSpectra.resize(indices.size());
+  for (size_t pointNo = 0; pointNo < indices.size(); ++pointNo) {
+    const auto i = indices[pointNo];
+    const V3D pos = m_spectrumInfo.position(i) / m_scale;
+    double *point = &m_scaledPositions[3 * pointNo];
+    point[0] = pos.X();
+    point[1] = pos.Y();
+    point[2] = pos.Z();
+    m_points[pointNo] = point;
+    m_pointSpectra[pointNo] = m_spectrumNumbers[i];
+  }
+
+  m_annTree = Kernel::make_unique<ANNkd_tree>(m_points.data(), nspectra, 3);
+}
+
+/**
+ * Builds a map based on the given number of neighbours
+ * @param noNeighbours :: The number of nearest neighbours to use to build
+ * the graph
+ */
+void WorkspaceNearestNeighbours::build(const int noNeighbours) {
+  const int nspectra = static_cast<int>(m_points.size());
   if (noNeighbours >= nspectra) {
     throw std::invalid_argument(
         "NearestNeighbours::build - Invalid number of neighbours");
@@ -126,67 +174,33 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   m_specToVertex.clear();
   m_noNeighbours = noNeighbours;
 
-  BoundingBox bbox;
-  // Base the scaling on the first detector, should be adequate but we can look
-  // at this
-  const auto &firstDet = m_spectrumInfo.detector(indices.front());
-  firstDet.getBoundingBox(bbox);
-  m_scale = V3D(bbox.width());
-  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
-  MapIV pointNoToVertex;
-
-  int pointNo = 0;
-  for (const auto i : indices) {
-    const specnum_t spectrum = m_spectrumNumbers[i];
-    V3D pos = m_spectrumInfo.position(i) / m_scale;
-    dataPoints[pointNo][0] = pos.X();
-    dataPoints[pointNo][1] = pos.Y();
-    dataPoints[pointNo][2] = pos.Z();
-    Vertex vertex = boost::add_vertex(spectrum, m_graph);
-    pointNoToVertex[pointNo] = vertex;
-    m_specToVertex[spectrum] = vertex;
-    ++pointNo;
+  for (const auto spectrum : m_pointSpectra) {
+    m_specToVertex[spectrum] = boost::add_vertex(spectrum, m_graph);
   }
 
-  auto annTree = new ANNkd_tree(dataPoints, nspectra, 3);
-  pointNo = 0;
   // Run the nearest neighbour search on each detector, reusing the arrays
-  auto nnIndexList = new ANNidx[m_noNeighbours];
-  auto nnDistList = new ANNdist[m_noNeighbours];
-
-  for (const auto idx : indices) {
-    ANNpoint scaledPos = dataPoints[pointNo];
-    annTree->annkSearch(scaledPos,      // Point to search nearest neighbours of
-                        m_noNeighbours, // Number of neighbours to find (8)
-                        nnIndexList,    // Index list of results
-                        nnDistList,     // List of distances to each of these
-                        0.0 // Error bound (?) is this the radius to search in?
+  std::vector<ANNidx> nnIndexList(m_noNeighbours);
+  std::vector<ANNdist> nnDistList(m_noNeighbours);
+
+  for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+    ANNpoint scaledPos = m_points[pointNo];
+    m_annTree->annkSearch(scaledPos, // Point to search nearest neighbours of
+                          m_noNeighbours,     // Number of neighbours to find
+                          nnIndexList.data(), // Index list of results
+                          nnDistList.data(),  // Distances to each of these
+                          0.0                 // Error bound
     );
     // The distances that are returned are in our scaled coordinate
     // system. We store the real space ones.
     V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
-    for (int i = 0; i < m_noNeighbours; i++) {
-      ANNidx index = nnIndexList[i];
-      V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1],
-                          dataPoints[index][2]) *
-                      m_scale;
-      V3D distance = neighbour - realPos;
-      double separation = distance.norm();
-      boost::add_edge(m_specToVertex[m_spectrumNumbers[idx]], // from
-                      pointNoToVertex[index],                 // to
+    for (const auto index : nnIndexList) {
+      const ANNpoint point = m_points[index];
+      V3D distance = V3D(point[0], point[1], point[2]) * m_scale - realPos;
+      boost::add_edge(static_cast<Vertex>(pointNo), // from
+                      static_cast<Vertex>(index),   // to
                       distance, m_graph);
-      if (separation > m_cutoff) {
-        m_cutoff = separation;
-      }
     }
-    pointNo++;
   }
-  delete[] nnIndexList;
-  delete[] nnDistList;
-  delete annTree;
-  annDeallocPts(dataPoints);
-  annClose();
-  pointNoToVertex.clear();
 
   m_vertexID = get(boost::vertex_name, m_graph);
   m_edgeLength = get(boost::edge_name, m_graph);
@@ -7,6 +7,7 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Property.h"
 
 #include <numeric>
@@ -169,6 +170,21 @@ static MatrixWorkspace_sptr createWorkspaceSingleValue(const double &rhsValue) {
 
 using OperatorOverloads::executeBinaryOperation;
 
+/** Checks whether the result of a binary operation can be written into its
+ * left hand side. This is the case for an unnamed histogram workspace that is
+ * referenced only by the operator argument, i.e. the result of another
+ * operator in an expression such as (a - b) / c, so that reusing it avoids
+ * allocating a new output workspace for every step of the expression.
+ *  @param lhs :: left hand side workspace shared pointer
+ *  @param rhs :: right hand side workspace shared pointer
+ *  @return True if the operation can be performed in place on lhs
+ */
+static bool isReusableTemporary(const MatrixWorkspace_sptr &lhs,
+                                const MatrixWorkspace_sptr &rhs) {
+  return lhs.use_count() == 1 && lhs->getName().empty() &&
+         lhs->id() == "Workspace2D" && lhs->size() >= rhs->size();
+}
+
 /** Adds two workspaces
  *  @param lhs :: left hand side workspace shared pointer
  *  @param rhs :: right hand side workspace shared pointer
@@ -176,8 +192,10 @@ using OperatorOverloads::executeBinaryOperation;
  */
 MatrixWorkspace_sptr operator+(const MatrixWorkspace_sptr lhs,
                                const MatrixWorkspace_sptr rhs) {
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>("Plus", lhs, rhs);
+                                MatrixWorkspace_sptr>("Plus", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Adds a workspace to a single value
@@ -187,9 +205,11 @@ MatrixWorkspace_sptr operator+(const MatrixWorkspace_sptr lhs,
  */
 MatrixWorkspace_sptr operator+(const MatrixWorkspace_sptr lhs,
                                const double &rhsValue) {
+  const auto rhs = createWorkspaceSingleValue(rhsValue);
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>(
-      "Plus", lhs, createWorkspaceSingleValue(rhsValue));
+                                MatrixWorkspace_sptr>("Plus", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Subtracts two workspaces
@@ -199,8 +219,10 @@ MatrixWorkspace_sptr operator+(const MatrixWorkspace_sptr lhs,
  */
 MatrixWorkspace_sptr operator-(const MatrixWorkspace_sptr lhs,
                                const MatrixWorkspace_sptr rhs) {
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>("Minus", lhs, rhs);
+                                MatrixWorkspace_sptr>("Minus", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Subtracts  a single value from a workspace
@@ -210,9 +232,11 @@ MatrixWorkspace_sptr operator-(const MatrixWorkspace_sptr lhs,
  */
 MatrixWorkspace_sptr operator-(const MatrixWorkspace_sptr lhs,
                                const double &rhsValue) {
+  const auto rhs = createWorkspaceSingleValue(rhsValue);
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>(
-      "Minus", lhs, createWorkspaceSingleValue(rhsValue));
+                                MatrixWorkspace_sptr>("Minus", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Subtracts a workspace from a single value
@@ -233,8 +257,10 @@ MatrixWorkspace_sptr operator-(const double &lhsValue,
  */
 MatrixWorkspace_sptr operator*(const MatrixWorkspace_sptr lhs,
                                const MatrixWorkspace_sptr rhs) {
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>("Multiply", lhs, rhs);
+                                MatrixWorkspace_sptr>("Multiply", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Multiply a workspace and a single value
@@ -244,9 +270,11 @@ MatrixWorkspace_sptr operator*(const MatrixWorkspace_sptr lhs,
  */
 MatrixWorkspace_sptr operator*(const MatrixWorkspace_sptr lhs,
                                const double &rhsValue) {
+  const auto rhs = createWorkspaceSingleValue(rhsValue);
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>(
-      "Multiply", lhs, createWorkspaceSingleValue(rhsValue));
+                                MatrixWorkspace_sptr>("Multiply", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Multiply a workspace and a single value. Allows you to write, e.g.,
@@ -269,8 +297,10 @@ MatrixWorkspace_sptr operator*(const double &lhsValue,
  */
 MatrixWorkspace_sptr operator/(const MatrixWorkspace_sptr lhs,
                                const MatrixWorkspace_sptr rhs) {
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>("Divide", lhs, rhs);
+                                MatrixWorkspace_sptr>("Divide", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Divide a workspace by a single value
@@ -280,9 +310,11 @@ MatrixWorkspace_sptr operator/(const MatrixWorkspace_sptr lhs,
  */
 MatrixWorkspace_sptr operator/(const MatrixWorkspace_sptr lhs,
                                const double &rhsValue) {
+  const auto rhs = createWorkspaceSingleValue(rhsValue);
+  const bool inPlace = isReusableTemporary(lhs, rhs);
   return executeBinaryOperation<MatrixWorkspace_sptr, MatrixWorkspace_sptr,
-                                MatrixWorkspace_sptr>(
-      "Divide", lhs, createWorkspaceSingleValue(rhsValue));
+                                MatrixWorkspace_sptr>("Divide", lhs, rhs,
+                                                      inPlace);
 }
 
 /** Divide a single value and a workspace. Allows you to write, e.g.,
@@ -541,7 +573,10 @@ void WorkspaceHelpers::makeDistribution(MatrixWorkspace_sptr workspace,
     throw std::runtime_error(
         "Workspace is using point data for x (should be bin edges).");
   }
-  for (size_t i = 0; i < numberOfSpectra; ++i) {
+  // Each spectrum is converted in place, only copying Y and E if they are
+  // shared with another spectrum or workspace
+  PARALLEL_FOR_IF(Kernel::threadSafe(*workspace))
+  for (int64_t i = 0; i < static_cast<int64_t>(numberOfSpectra); ++i) {
     if (forwards) {
       workspace->convertToFrequencies(i);
     } else {
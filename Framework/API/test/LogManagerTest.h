@@ -398,6 +398,59 @@ public:
     TS_ASSERT_EQUALS(runInfo.getPropertyAsSingleValue(name), value);
   }
 
+  void
+  test_GetPropertyAsSingleValue_Returns_Correct_Value_After_Logs_Are_Filtered() {
+    LogManager runInfo;
+    const std::string name = "series";
+    addTestTimeSeries<double>(runInfo, name);
+    TS_ASSERT_DELTA(runInfo.getPropertyAsSingleValue(name, Math::Mean), 13.0,
+                    1e-12);
+    TS_ASSERT_DELTA(runInfo.getPropertyAsSingleValue(name, Math::Median), 13.0,
+                    1e-12);
+
+    runInfo.filterByTime(DateAndTime("2012-07-19T16:17:00"),
+                         DateAndTime("2012-07-19T16:17:45"));
+    const auto stats =
+        runInfo.getTimeSeriesProperty<double>(name)->getStatistics();
+    TS_ASSERT_DIFFERS(stats.mean, 13.0);
+    TS_ASSERT_DELTA(runInfo.getPropertyAsSingleValue(name, Math::Mean),
+                    stats.mean, 1e-12);
+    TS_ASSERT_DELTA(runInfo.getPropertyAsSingleValue(name, Math::Median),
+                    stats.median, 1e-12);
+  }
+
+  void test_getTimeAveragedStd() {
+    LogManager runInfo;
+    const std::string name = "series";
+    addTestTimeSeries<double>(runInfo, name);
+    const auto stats =
+        runInfo.getTimeSeriesProperty<double>(name)->getStatistics();
+
+    TS_ASSERT_DELTA(runInfo.getTimeAveragedStd(name),
+                    stats.time_standard_deviation, 1e-12);
+    // The second call is served from the cache
+    TS_ASSERT_DELTA(runInfo.getTimeAveragedStd(name),
+                    stats.time_standard_deviation, 1e-12);
+
+    runInfo.addProperty("single", 5.0);
+    TS_ASSERT_THROWS(runInfo.getTimeAveragedStd("single"),
+                     std::invalid_argument);
+  }
+
+  void test_removeProperty_forgets_statistics_regardless_of_case() {
+    LogManager runInfo;
+    const std::string name = "series";
+    addTestTimeSeries<double>(runInfo, name);
+    TS_ASSERT_DIFFERS(runInfo.getTimeAveragedStd(name), 0.0);
+
+    runInfo.removeProperty("SERIES");
+    auto constant = new TimeSeriesProperty<double>(name);
+    constant->addValue("2012-07-19T16:17:00", 3.0);
+    constant->addValue("2012-07-19T16:18:00", 3.0);
+    runInfo.addProperty(constant);
+    TS_ASSERT_DELTA(runInfo.getTimeAveragedStd(name), 0.0, 1e-12);
+  }
+
   void test_clear() {
     // Set up a Run object with 3 properties in it (1 time series, 2 single
     // value)
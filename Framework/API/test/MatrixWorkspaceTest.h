@@ -465,6 +465,33 @@ public:
     TS_ASSERT_EQUALS(ws.size(), 0);
   }
 
+  void test_shareIdenticalX() {
+    WorkspaceTester ws;
+    ws.initialize(4, 3, 2);
+    // Give every spectrum its own copy of X, two of them with other values
+    for (size_t i = 0; i < 4; ++i)
+      ws.mutableX(i) = {1.0, 2.0, 3.0};
+    ws.mutableX(1)[2] = 4.0;
+    ws.mutableX(3)[2] = 4.0;
+    TS_ASSERT_DIFFERS(&ws.x(0), &ws.x(2));
+
+    ws.shareIdenticalX();
+    TS_ASSERT_EQUALS(&ws.x(0), &ws.x(2));
+    TS_ASSERT_EQUALS(&ws.x(1), &ws.x(3));
+    TS_ASSERT_DIFFERS(&ws.x(0), &ws.x(1));
+    TS_ASSERT_EQUALS(ws.x(2)[2], 3.0);
+    TS_ASSERT_EQUALS(ws.x(3)[2], 4.0);
+    TS_ASSERT(!ws.isCommonBins());
+
+    // Copy-on-write keeps shared X independent
+    ws.mutableX(1)[2] = 3.0;
+    TS_ASSERT_EQUALS(ws.x(3)[2], 4.0);
+    ws.mutableX(3)[2] = 3.0;
+    ws.shareIdenticalX();
+    TS_ASSERT_EQUALS(&ws.x(0), &ws.x(3));
+    TS_ASSERT(ws.isCommonBins());
+  }
+
   void test_updateSpectraUsing() {
     WorkspaceTester testWS;
     testWS.initialize(3, 1, 1);
@@ -276,6 +276,47 @@ public:
     detectorInfo.setPosition(1, oldPos);
   }
 
+  void test_cacheGeometry() {
+    auto ws = makeDefaultWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    std::vector<double> l2;
+    std::vector<double> twoTheta;
+    for (size_t i = 0; i < 3; ++i) {
+      l2.push_back(spectrumInfo.l2(i));
+      twoTheta.push_back(spectrumInfo.twoTheta(i));
+    }
+    TS_ASSERT_THROWS_NOTHING(ws.mutableSpectrumInfo().cacheGeometry());
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(spectrumInfo.l2(i), l2[i]);
+      TS_ASSERT_EQUALS(spectrumInfo.twoTheta(i), twoTheta[i]);
+    }
+    TS_ASSERT_EQUALS(spectrumInfo.l2(3), -9.0);
+    // Monitors
+    TS_ASSERT_THROWS(spectrumInfo.twoTheta(3), std::logic_error);
+    TS_ASSERT_THROWS(spectrumInfo.signedTwoTheta(4), std::logic_error);
+  }
+
+  void test_cacheGeometry_ignored_after_setPosition() {
+    auto ws = makeDefaultWorkspace();
+    ws.mutableSpectrumInfo().cacheGeometry();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.twoTheta(0), 0.0199973, 1e-6);
+    auto &detectorInfo = ws.mutableDetectorInfo();
+    // Move detector 1 onto the beam axis
+    detectorInfo.setPosition(0, V3D(0.0, 0.0, 5.0));
+    TS_ASSERT_DELTA(spectrumInfo.twoTheta(0), 0.0, 1e-6);
+    TS_ASSERT_DELTA(spectrumInfo.l2(0), 5.0, 1e-12);
+  }
+
+  void test_cacheGeometry_ignored_after_changing_grouping() {
+    auto ws = makeDefaultWorkspace();
+    ws.mutableSpectrumInfo().cacheGeometry();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.twoTheta(1), 0.0, 1e-6);
+    ws.getSpectrum(1).setDetectorIDs({1, 3});
+    TS_ASSERT_DELTA(spectrumInfo.twoTheta(1), 0.0199973, 1e-6);
+  }
+
   void test_hasDetectors() {
     const auto &spectrumInfo = m_workspace.spectrumInfo();
     TS_ASSERT(spectrumInfo.hasDetectors(0));
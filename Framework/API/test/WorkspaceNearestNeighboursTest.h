@@ -172,6 +172,37 @@ public:
     TS_ASSERT_EQUALS(nb.size(), 4);
   }
 
+  void test_neighboursInRadius_returns_all_spectra_within_radius() {
+    const auto ws = makeWorkspace(256, 767);
+    ws->setInstrument(
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 16));
+    const auto &spectrumInfo = ws->spectrumInfo();
+    WorkspaceNearestNeighbours nn(8, spectrumInfo, getSpectrumNumbers(*ws));
+
+    const double radius = 0.05;
+    for (const size_t index : {0, 37, 255, 300}) {
+      const specnum_t spec = static_cast<specnum_t>(index) + 256;
+      const auto nb = nn.neighboursInRadius(spec, radius);
+      std::map<specnum_t, V3D> expected;
+      for (size_t i = 0; i < spectrumInfo.size(); ++i) {
+        const V3D distance =
+            spectrumInfo.position(i) - spectrumInfo.position(index);
+        if (i != index && distance.norm() <= radius)
+          expected[static_cast<specnum_t>(i) + 256] = distance;
+      }
+      // Many more than the 8 neighbours the graph was built with
+      TS_ASSERT_LESS_THAN(8, expected.size());
+      TS_ASSERT_EQUALS(nb.size(), expected.size());
+      for (const auto &neighbour : expected) {
+        TS_ASSERT_EQUALS(nb.count(neighbour.first), 1);
+        TS_ASSERT_DELTA((nb.at(neighbour.first) - neighbour.second).norm(),
+                        0.0, 1e-12);
+      }
+    }
+    // The default neighbours are unaffected by radius queries
+    TS_ASSERT_EQUALS(nn.neighbours(300).size(), 8);
+  }
+
   void testIgnoreAndApplyMasking() {
     const auto ws = makeWorkspace(1, 18);
     ws->setInstrument(
@@ -192,6 +192,10 @@ private:
 
   Kernel::TimeSeriesProperty<double> *m_dblLog;
   Kernel::TimeSeriesProperty<int> *m_intLog;
+  /// Times of the entries of the double log, read once for all the filters
+  std::vector<Types::Core::DateAndTime> m_dblLogTimes;
+  /// Values of the entries of the double log
+  std::vector<double> m_dblLogValues;
 
   bool m_logAtCentre;
   double m_logTimeTolerance;
@@ -31,6 +31,11 @@ struct DLLExport SofQCommon {
   double q(const double deltaE, const double twoTheta,
            const Geometry::IDetector *det) const;
 
+  /// Calculate the Q values for energy transfers at a single angle
+  std::vector<double> qValues(const std::vector<double> &deltaE,
+                              const double twoTheta,
+                              const Geometry::IDetector *det) const;
+
   /// Estimate minimum and maximum momentum transfer.
   std::pair<double, double> qBinHints(const API::MatrixWorkspace &ws,
                                       const double minE,
@@ -68,11 +68,12 @@ private:
 
   void filterEventList(const API::IEventList &eventList, const int minVal,
                        const int maxVal,
-                       const Kernel::TimeSeriesProperty<int> *log,
-                       std::vector<int> &Y);
+                       const std::vector<Types::Core::DateAndTime> &logTimes,
+                       const std::vector<int> &logValues, std::vector<int> &Y);
   void addMonitorCounts(API::ITableWorkspace_sptr outputWorkspace,
-                        const Kernel::TimeSeriesProperty<int> *log,
-                        const int minVal, const int maxVal);
+                        const std::vector<Types::Core::DateAndTime> &logTimes,
+                        const std::vector<int> &logValues, const int minVal,
+                        const int maxVal);
   std::vector<std::pair<std::string, const Kernel::ITimeSeriesProperty *>>
   getNumberSeriesLogs();
   double
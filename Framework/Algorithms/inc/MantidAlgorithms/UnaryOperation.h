@@ -59,6 +59,7 @@ protected:
   void init() override;
   void exec() override;
   virtual void execEvent();
+  void execInPlace(API::MatrixWorkspace &workspace, const size_t index);
   template <class T> void unaryOperationEventHelper(std::vector<T> &wevector);
   /// The name of the input workspace property
   virtual const std::string inputPropName() const { return "InputWorkspace"; }
@@ -57,14 +57,15 @@ Mantid::Kernel::TimeSeriesProperty<double> *AddLogDerivative::makeDerivative(
         Strings::toString(input->size()) + " values. Need at least " +
         Strings::toString(numDerivatives + 1) + " to make this derivative.");
 
-  std::vector<double> values, dVal;
-  std::vector<double> times, dTime;
-  values = input->valuesAsVector();
-  times = input->timesAsVectorSeconds();
+  std::vector<double> values = input->valuesAsVector();
+  std::vector<double> times = input->timesAsVectorSeconds();
 
   for (int deriv = 0; deriv < numDerivatives; deriv++) {
-    dVal.clear();
-    dTime.clear();
+    if (times.empty())
+      break;
+    // The derivative is written over the input as it goes: each output point
+    // only depends on input points at the same or a later index.
+    size_t numOut = 0;
     double t0 = times[0];
     double y0 = values[0];
     for (size_t i = 0; i < times.size() - 1; i++) {
@@ -72,17 +73,16 @@ Mantid::Kernel::TimeSeriesProperty<double> *AddLogDerivative::makeDerivative(
       double t1 = times[i + 1];
       if (t1 != t0) {
         // Avoid repeated time values giving infinite derivatives
-        double dy = (y1 - y0) / (t1 - t0);
-        double t = (t0 + t1) / 2.0;
-        dVal.push_back(dy);
-        dTime.push_back(t);
+        values[numOut] = (y1 - y0) / (t1 - t0);
+        times[numOut] = (t0 + t1) / 2.0;
+        ++numOut;
         // For the next time interval
         t0 = t1;
         y0 = y1;
       }
     }
-    times = dTime;
-    values = dVal;
+    times.resize(numOut);
+    values.resize(numOut);
 
     progress.report("Add Log Derivative");
   }
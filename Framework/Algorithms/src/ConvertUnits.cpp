@@ -464,8 +464,6 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   double l1 = spectrumInfo.l1();
   g_log.debug() << "Source-sample distance: " << l1 << '\n';
 
-  int failedDetectorCount = 0;
-
   /// @todo No implementation for any of these in the geometry yet so using
   /// properties
   const std::string emodeStr = getProperty("EMode");
@@ -539,46 +537,71 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
       boost::dynamic_pointer_cast<EventWorkspace>(outputWS);
   assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
 
-  auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
+  // Gather the conversion parameters of all spectra up front: the look-ups of
+  // the geometry and of the instrument parameters are not thread safe, the
+  // conversion itself is done in parallel below.
+  std::vector<double> efixeds(m_numberOfSpectra, efixedProp);
+  std::vector<double> l2s(m_numberOfSpectra);
+  std::vector<double> twoThetas(m_numberOfSpectra);
+  std::vector<bool> hasValues(m_numberOfSpectra);
+  // L2 and 2theta are needed for every spectrum, keep them for later calls
+  outputWS->mutableSpectrumInfo().cacheGeometry();
+  const auto &outSpectrumInfo = outputWS->spectrumInfo();
+  for (size_t i = 0; i < m_numberOfSpectra; ++i) {
+    hasValues[i] = getDetectorValues(outSpectrumInfo, *outputUnit, emode,
+                                     *outputWS, signedTheta, i, efixeds[i],
+                                     l2s[i], twoThetas[i]);
+  }
+
   // Loop over the histograms (detector spectra)
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
-    double efixed = efixedProp;
-
-    // Now get the detector object for this histogram
-    double l2;
-    double twoTheta;
-    if (getDetectorValues(outSpectrumInfo, *outputUnit, emode, *outputWS,
-                          signedTheta, i, efixed, l2, twoTheta)) {
+    PARALLEL_START_INTERUPT_REGION
+    if (hasValues[i]) {
+      // The units hold the parameters of the conversion, so each spectrum
+      // needs its own copies
+      std::unique_ptr<Unit> spectrumFromUnit(localFromUnit->clone());
+      std::unique_ptr<Unit> spectrumOutputUnit(localOutputUnit->clone());
 
       /// @todo Don't yet consider hold-off (delta)
       const double delta = 0.0;
 
       // TODO toTOF and fromTOF need to be reimplemented outside of kernel
-      localFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                           emode, efixed, delta);
+      spectrumFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, l2s[i],
+                              twoThetas[i], emode, efixeds[i], delta);
       // Convert from time-of-flight to the desired unit
-      localOutputUnit->fromTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                               emode, efixed, delta);
+      spectrumOutputUnit->fromTOF(outputWS->dataX(i), emptyVec, l1, l2s[i],
+                                  twoThetas[i], emode, efixeds[i], delta);
 
       // EventWorkspace part, modifying the EventLists.
       if (m_inputEvents) {
-        eventWS->getSpectrum(i).convertUnitsViaTof(localFromUnit.get(),
-                                                   localOutputUnit.get());
+        eventWS->getSpectrum(i).convertUnitsViaTof(spectrumFromUnit.get(),
+                                                   spectrumOutputUnit.get());
       }
     } else {
       // Get to here if exception thrown when calculating distance to detector
-      failedDetectorCount++;
       // Since you usually (always?) get to here when there's no attached
       // detectors, this call is
       // the same as just zeroing out the data (calling clearData on the
       // spectrum)
       outputWS->getSpectrum(i).clearData();
-      if (outSpectrumInfo.hasDetectors(i))
-        outSpectrumInfo.setMasked(i, true);
     }
 
     prog.report("Convert to " + m_outputUnit->unitID());
+    PARALLEL_END_INTERUPT_REGION
   } // loop over spectra
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Masking modifies the shared detector information so is done afterwards
+  int failedDetectorCount = 0;
+  auto &mutableOutSpectrumInfo = outputWS->mutableSpectrumInfo();
+  for (size_t i = 0; i < m_numberOfSpectra; ++i) {
+    if (hasValues[i])
+      continue;
+    failedDetectorCount++;
+    if (mutableOutSpectrumInfo.hasDetectors(i))
+      mutableOutSpectrumInfo.setMasked(i, true);
+  }
 
   if (failedDetectorCount != 0) {
     g_log.information() << "Unable to calculate sample-detector distance for "
@@ -235,6 +235,10 @@ void CreateWorkspace::exec() {
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  // Spectra given identical X values in DataX share a single copy of them
+  if (!commonX)
+    outputWS->shareIdenticalX();
+
   // Set the Unit of the X Axis
   try {
     outputWS->getAxis(0)->unit() = UnitFactory::Instance().create(xUnit);
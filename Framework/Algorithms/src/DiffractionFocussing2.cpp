@@ -15,6 +15,7 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <iterator>
 #include <numeric>
@@ -29,6 +30,71 @@ namespace Mantid {
 
 namespace Algorithms {
 
+namespace {
+/** Resizes the events of an event list to the given number of events.
+ * @param eventList :: The event list, already switched to its final type
+ * @param numEvents :: The new number of events
+ */
+void resizeEvents(EventList &eventList, const size_t numEvents) {
+  switch (eventList.getEventType()) {
+  case TOF:
+    eventList.getEvents().resize(numEvents);
+    break;
+  case WEIGHTED:
+    eventList.getWeightedEvents().resize(numEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    eventList.getWeightedEventsNoTime().resize(numEvents);
+    break;
+  }
+}
+
+/** Copies events into an output vector starting at the given offset,
+ * converting them to the output event type.
+ */
+template <class InputEvent, class OutputEvent>
+void copyEvents(const std::vector<InputEvent> &input,
+                std::vector<OutputEvent> &output, const size_t offset) {
+  std::copy(input.cbegin(), input.cend(),
+            std::next(output.begin(), static_cast<std::ptrdiff_t>(offset)));
+}
+
+/** Copies all events of an input list into the output list starting at the
+ * given offset. The output list must have been resized beforehand and have an
+ * event type that the input events can be converted to, i.e. the most
+ * specialised type of all inputs.
+ * @param input :: The event list to copy from
+ * @param output :: The event list to copy to
+ * @param offset :: Index of the first output event to overwrite
+ */
+void copyEvents(const EventList &input, EventList &output,
+                const size_t offset) {
+  const auto inputType = input.getEventType();
+  switch (output.getEventType()) {
+  case TOF:
+    copyEvents(input.getEvents(), output.getEvents(), offset);
+    break;
+  case WEIGHTED:
+    if (inputType == TOF)
+      copyEvents(input.getEvents(), output.getWeightedEvents(), offset);
+    else
+      copyEvents(input.getWeightedEvents(), output.getWeightedEvents(),
+                 offset);
+    break;
+  case WEIGHTED_NOTIME:
+    if (inputType == TOF)
+      copyEvents(input.getEvents(), output.getWeightedEventsNoTime(), offset);
+    else if (inputType == WEIGHTED)
+      copyEvents(input.getWeightedEvents(), output.getWeightedEventsNoTime(),
+                 offset);
+    else
+      copyEvents(input.getWeightedEventsNoTime(),
+                 output.getWeightedEventsNoTime(), offset);
+    break;
+  }
+}
+} // namespace
+
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(DiffractionFocussing2)
 
@@ -346,103 +412,81 @@ void DiffractionFocussing2::execEvent() {
   std::unique_ptr<Progress> prog =
       make_unique<Progress>(this, 0.2, 0.25, nGroups);
 
-  // determine precount size
-  vector<size_t> size_required(this->m_validGroups.size(), 0);
-  int totalHistProcess = 0;
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
-    const vector<size_t> &indices = this->m_wsIndices[iGroup];
-
-    totalHistProcess += static_cast<int>(indices.size());
-    for (auto index : indices) {
+  // Pre-count the events of every group and give each input spectrum its own
+  // slice of the output list of its group, so that the events can be copied
+  // in parallel without any locking
+  const size_t nValidGroups = this->m_validGroups.size();
+  vector<size_t> size_required(nValidGroups, 0);
+  vector<size_t> inputIndices;
+  vector<size_t> outputIndices;
+  vector<size_t> offsets;
+  for (size_t iGroup = 0; iGroup < nValidGroups; iGroup++) {
+    for (auto index : this->m_wsIndices[iGroup]) {
+      inputIndices.push_back(index);
+      outputIndices.push_back(iGroup);
+      offsets.push_back(size_required[iGroup]);
       size_required[iGroup] += m_eventW->getSpectrum(index).getNumberEvents();
     }
     prog->report(1, "Pre-counting");
   }
+  const int totalHistProcess = static_cast<int>(inputIndices.size());
 
   // ------------- Pre-allocate Event Lists ----------------------------
   prog.reset();
-  prog = make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
+  prog = make_unique<Progress>(this, 0.25, 0.3, nGroups);
+
+  // getSpectrum modifies the workspace, so the output lists are looked up
+  // once here and only used through these pointers in the parallel loops
+  vector<EventList *> groupLists(nValidGroups);
+  for (size_t iGroup = 0; iGroup < nValidGroups; iGroup++)
+    groupLists[iGroup] = &out->getSpectrum(iGroup);
 
-  // This creates and reserves the space required
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
+  // This creates the event lists at their final size
+  PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW))
+  for (int iGroup = 0; iGroup < static_cast<int>(nValidGroups); iGroup++) {
+    PARALLEL_START_INTERUPT_REGION
     const int group = static_cast<int>(m_validGroups[iGroup]);
-    EventList &groupEL = out->getSpectrum(iGroup);
+    EventList &groupEL = *groupLists[iGroup];
     groupEL.switchTo(eventWtype);
-    groupEL.reserve(size_required[iGroup]);
+    resizeEvents(groupEL, size_required[iGroup]);
     groupEL.clearDetectorIDs();
+    for (auto wi : this->m_wsIndices[iGroup])
+      groupEL.addDetectorIDs(m_eventW->getSpectrum(wi).getDetectorIDs());
     groupEL.setSpectrumNo(group);
-    prog->reportIncrement(1, "Allocating");
+    // No guaranteed order
+    groupEL.setSortOrder(UNSORTED);
+    prog->report("Allocating");
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
 
   // ----------- Focus ---------------
   prog.reset();
   prog = make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
 
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = out->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    int chunkSize = 200;
-
-    int end = (totalHistProcess / chunkSize) + 1;
-    // cppcheck-suppress syntaxError
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
-      }
-
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
-        groupEL += chunkEL;
-      }
-
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } else {
-    // ------ PARALLELIZE BY GROUPS -------------------------
-
-    int nValidGroups = static_cast<int>(this->m_validGroups.size());
-    PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW))
-    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
-      PARALLEL_START_INTERUPT_REGION
-      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
-      for (auto wi : indices) {
-        // In workspace index iGroup, put what was in the OLD workspace index wi
-        out->getSpectrum(iGroup) += m_eventW->getSpectrum(wi);
-
-        prog->reportIncrement(1, "Appending Lists");
-
-        // When focussing in place, you can clear out old memory from the input
-        // one!
-        if (inPlace) {
-          boost::const_pointer_cast<EventWorkspace>(m_eventW)
-              ->getSpectrum(wi)
-              .clear();
-        }
-      }
-      PARALLEL_END_INTERUPT_REGION
+  // Parallelize over the input spectra rather than the groups, so that a
+  // small number of groups does not limit the number of threads used
+  PRAGMA_OMP(parallel for schedule(dynamic, 1)
+             if (Kernel::threadSafe(*m_eventW)))
+  for (int i = 0; i < totalHistProcess; i++) {
+    PARALLEL_START_INTERUPT_REGION
+    const size_t wi = inputIndices[i];
+    // Put what was in the OLD workspace index wi in its slice of the group
+    copyEvents(m_eventW->getSpectrum(wi), *groupLists[outputIndices[i]],
+               offsets[i]);
+
+    prog->report("Appending Lists");
+
+    // When focussing in place, you can clear out old memory from the input
+    // one!
+    if (inPlace) {
+      boost::const_pointer_cast<EventWorkspace>(m_eventW)
+          ->getSpectrum(wi)
+          .clear();
     }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } // (done with parallel by groups)
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
 
   // Now that the data is cleaned up, go through it and set the X vectors to the
   // input workspace we first talked about.
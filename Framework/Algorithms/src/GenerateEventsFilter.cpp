@@ -7,6 +7,7 @@
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
+#include <algorithm>
 #include <boost/math/special_functions/round.hpp>
 
 using namespace Mantid;
@@ -512,6 +513,10 @@ void GenerateEventsFilter::setFilterByLogValue(std::string logname) {
     if (m_runEndTime > m_dblLog->lastTime())
       m_dblLog->addValue(m_runEndTime, 0.);
     m_dblLog->eliminateDuplicates();
+    // Read the entries once so that the filters are generated from plain
+    // vectors rather than through per-entry property look ups
+    m_dblLogTimes = m_dblLog->timesAsVector();
+    m_dblLogValues = m_dblLog->valuesAsVector();
   } else {
     g_log.debug("Attempting to remove duplicates in integer series log.");
     m_intLog->addValue(m_runEndTime, 0);
@@ -557,10 +562,12 @@ void GenerateEventsFilter::setFilterByLogValue(std::string logname) {
     // Double TimeSeriesProperty log
     // Process min/max
     if (minvalue == EMPTY_DBL()) {
-      minvalue = m_dblLog->minValue();
+      minvalue =
+          *std::min_element(m_dblLogValues.cbegin(), m_dblLogValues.cend());
     }
     if (maxvalue == EMPTY_DBL()) {
-      maxvalue = m_dblLog->maxValue();
+      maxvalue =
+          *std::max_element(m_dblLogValues.cbegin(), m_dblLogValues.cend());
     }
 
     if (minvalue > maxvalue) {
@@ -753,8 +760,10 @@ void GenerateEventsFilter::processMultipleValueFilters(double minvalue,
     // Warning information
     double upperboundinterval0 = logvalueranges[1];
     double lowerboundlastinterval = logvalueranges[logvalueranges.size() - 2];
-    double minlogvalue = m_dblLog->minValue();
-    double maxlogvalue = m_dblLog->maxValue();
+    const auto logrange =
+        std::minmax_element(m_dblLogValues.cbegin(), m_dblLogValues.cend());
+    double minlogvalue = *logrange.first;
+    double maxlogvalue = *logrange.second;
     if (minlogvalue > upperboundinterval0 ||
         maxlogvalue < lowerboundlastinterval) {
       g_log.warning()
@@ -810,7 +819,7 @@ void GenerateEventsFilter::makeFilterBySingleValue(
     bool filterIncrease, bool filterDecrease, DateAndTime startTime,
     Types::Core::DateAndTime stopTime, int wsindex) {
   // Do nothing if the log is empty.
-  if (m_dblLog->size() == 0) {
+  if (m_dblLogValues.empty()) {
     g_log.warning() << "There is no entry in this property " << this->name()
                     << "\n";
     return;
@@ -829,10 +838,11 @@ void GenerateEventsFilter::makeFilterBySingleValue(
   DateAndTime start, stop;
 
   size_t progslot = 0;
-  for (int i = 0; i < m_dblLog->size(); i++) {
+  const int numlogentries = static_cast<int>(m_dblLogValues.size());
+  for (int i = 0; i < numlogentries; i++) {
     lastTime = currT;
     // The new entry
-    currT = m_dblLog->nthTime(i);
+    currT = m_dblLogTimes[i];
 
     // A good value?
     isGood = identifyLogEntry(i, currT, lastGood, min, max, startTime, stopTime,
@@ -867,7 +877,7 @@ void GenerateEventsFilter::makeFilterBySingleValue(
     }
 
     // Progress bar..
-    size_t tmpslot = i * 90 / m_dblLog->size();
+    size_t tmpslot = i * 90 / numlogentries;
     if (tmpslot > progslot) {
       progslot = tmpslot;
       double prog = double(progslot) / 100.0 + 0.1;
@@ -906,7 +916,7 @@ bool GenerateEventsFilter::identifyLogEntry(
     const Types::Core::DateAndTime &startT,
     const Types::Core::DateAndTime &stopT, const bool &filterIncrease,
     const bool &filterDecrease) {
-  double val = m_dblLog->nthValue(index);
+  double val = m_dblLogValues[index];
 
   // Identify by time and value
   bool isgood =
@@ -914,14 +924,14 @@ bool GenerateEventsFilter::identifyLogEntry(
 
   // Consider direction: not both (i.e., not increase or not decrease)
   if (isgood && (!filterIncrease || !filterDecrease)) {
-    int numlogentries = m_dblLog->size();
+    int numlogentries = static_cast<int>(m_dblLogValues.size());
     double diff;
     if (index < numlogentries - 1) {
       // For a non-last log entry
-      diff = m_dblLog->nthValue(index + 1) - val;
+      diff = m_dblLogValues[index + 1] - val;
     } else {
       // Last log entry: follow the last direction
-      diff = val - m_dblLog->nthValue(index - 1);
+      diff = val - m_dblLogValues[index - 1];
     }
 
     if (diff > 0 && filterIncrease)
@@ -960,7 +970,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValues(
   g_log.notice("Starting method 'makeMultipleFiltersByValues'. ");
 
   // Return if the log is empty.
-  int logsize = m_dblLog->size();
+  int logsize = static_cast<int>(m_dblLogValues.size());
   if (logsize == 0) {
     g_log.warning() << "There is no entry in this property " << m_dblLog->name()
                     << '\n';
@@ -1014,7 +1024,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
     bool centre, bool filterIncrease, bool filterDecrease,
     DateAndTime startTime, DateAndTime stopTime) {
   // Return if the log is empty.
-  int logsize = m_dblLog->size();
+  int logsize = static_cast<int>(m_dblLogValues.size());
   if (logsize == 0) {
     g_log.warning() << "There is no entry in this property " << m_dblLog->name()
                     << '\n';
@@ -1074,9 +1084,9 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesParallel(
   m_vecGroupIndexSet.clear();
   for (int i = 0; i < numThreads; ++i) {
     vector<DateAndTime> tempvectimes;
-    tempvectimes.reserve(m_dblLog->size());
+    tempvectimes.reserve(logsize);
     vector<int> tempvecgroup;
-    tempvecgroup.reserve(m_dblLog->size());
+    tempvecgroup.reserve(logsize);
     m_vecSplitterTimeSet.push_back(tempvectimes);
     m_vecGroupIndexSet.push_back(tempvecgroup);
   }
@@ -1174,7 +1184,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
     bool filterIncrease, bool filterDecrease, DateAndTime startTime,
     DateAndTime stopTime) {
   // Check
-  int logsize = m_dblLog->size();
+  int logsize = static_cast<int>(m_dblLogValues.size());
   if (istart < 0 || iend >= logsize)
     throw runtime_error("Input index of makeMultipleFiltersByValuesPartialLog "
                         "is out of boundary. ");
@@ -1191,11 +1201,11 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
   // size_t progslot = 0;
 
   g_log.information() << "Log time coverage (index: " << istart << ", " << iend
-                      << ") from " << m_dblLog->nthTime(istart) << ", "
-                      << m_dblLog->nthTime(iend) << "\n";
+                      << ") from " << m_dblLogTimes[istart] << ", "
+                      << m_dblLogTimes[iend] << "\n";
 
   DateAndTime laststoptime(0);
-  int lastlogindex = m_dblLog->size() - 1;
+  int lastlogindex = logsize - 1;
 
   int prevDirection = determineChangingDirection(istart);
 
@@ -1205,8 +1215,8 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
     bool createsplitter = false;
 
     lastTime = currTime;
-    currTime = m_dblLog->nthTime(i);
-    double currValue = m_dblLog->nthValue(i);
+    currTime = m_dblLogTimes[i];
+    double currValue = m_dblLogValues[i];
 
     // Filter out by time and direction (optional)
     bool intime = true;
@@ -1230,7 +1240,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
     int direction = 0;
     if (i < lastlogindex) {
       // Not the last log entry
-      double diff = m_dblLog->nthValue(i + 1) - m_dblLog->nthValue(i);
+      double diff = m_dblLogValues[i + 1] - m_dblLogValues[i];
       if (diff > 0)
         direction = 1;
       else if (diff < 0)
@@ -1321,7 +1331,7 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
             } else {
               // An impossible situation
               std::stringstream errmsg;
-              double lastvalue = m_dblLog->nthValue(i - 1);
+              double lastvalue = m_dblLogValues[i - 1];
               errmsg << "Impossible to have currindex == lastindex == "
                      << currindex
                      << ", while start is not init.  Log Index = " << i
@@ -1397,8 +1407,8 @@ void GenerateEventsFilter::makeMultipleFiltersByValuesPartialLog(
   // time
   // To make it non-empty
   if (vecSplitTime.empty()) {
-    start = m_dblLog->nthTime(istart);
-    stop = m_dblLog->nthTime(iend);
+    start = m_dblLogTimes[istart];
+    stop = m_dblLogTimes[iend];
     lastindex = -1;
     makeSplitterInVector(vecSplitTime, vecSplitGroup, start, stop, lastindex,
                          tol_ns, laststoptime);
@@ -1618,7 +1628,7 @@ int GenerateEventsFilter::determineChangingDirection(int startindex) {
   // Search to earlier entries
   int index = startindex;
   while (direction == 0 && index > 0) {
-    double diff = m_dblLog->nthValue(index) - m_dblLog->nthValue(index - 1);
+    double diff = m_dblLogValues[index] - m_dblLogValues[index - 1];
     if (diff > 0)
       direction = 1;
     else if (diff < 0)
@@ -1632,9 +1642,9 @@ int GenerateEventsFilter::determineChangingDirection(int startindex) {
 
   // Search to later entries
   index = startindex;
-  int maxindex = m_dblLog->size() - 1;
+  int maxindex = static_cast<int>(m_dblLogValues.size()) - 1;
   while (direction == 0 && index < maxindex) {
-    double diff = m_dblLog->nthValue(index + 1) - m_dblLog->nthValue(index);
+    double diff = m_dblLogValues[index + 1] - m_dblLogValues[index];
     if (diff > 0)
       direction = 1;
     else if (diff < 0)
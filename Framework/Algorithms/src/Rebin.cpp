@@ -12,6 +12,8 @@
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -30,6 +32,24 @@ using HistogramData::Frequencies;
 using HistogramData::FrequencyStandardDeviations;
 using HistogramData::Histogram;
 
+namespace {
+/// Returns true if a spectrum has neither counts nor errors and valid bin
+/// edges, so that rebinning it gives only zeros. Invalid bin edges are left
+/// to HistogramData::rebin, which reports them.
+bool rebinsToZero(const HistogramData::HistogramX &x,
+                  const HistogramData::HistogramY &y,
+                  const HistogramData::HistogramE &e) {
+  for (size_t i = 0; i < y.size(); ++i) {
+    if (y[i] != 0.0 || e[i] != 0.0)
+      return false;
+  }
+  return std::adjacent_find(x.cbegin(), x.cend(),
+                            [](const double low, const double high) {
+                              return !(low < high);
+                            }) == x.cend();
+}
+} // namespace
+
 //---------------------------------------------------------------------------------------------
 // Public static methods
 //---------------------------------------------------------------------------------------------
@@ -185,6 +205,12 @@ void Rebin::exec() {
         PARALLEL_START_INTERUPT_REGION
         // Get a const event list reference. eventInputWS->dataY() doesn't work.
         const EventList &el = eventInputWS->getSpectrum(i);
+        // Empty spectra keep the zeroed Y and E shared by all spectra of the
+        // new workspace, so that near-empty data does not allocate them
+        if (el.empty()) {
+          prog.report(name());
+          continue;
+        }
         MantidVec y_data, e_data;
         // The EventList takes care of histogramming.
         el.generateHistogram(XValues_new.rawData(), y_data, e_data);
@@ -249,6 +275,12 @@ void Rebin::exec() {
     for (int hist = 0; hist < histnumber; ++hist) {
       PARALLEL_START_INTERUPT_REGION
 
+      // Spectra without counts or errors keep the zeroed Y and E that are
+      // shared by all spectra of the new workspace
+      if (rebinsToZero(inputWS->x(hist), inputWS->y(hist), inputWS->e(hist))) {
+        prog.report(name());
+        continue;
+      }
       try {
         outputWS->setHistogram(
             hist, HistogramData::rebin(inputWS->histogram(hist), XValues_new));
@@ -38,18 +38,23 @@ void Scale::exec() {
 
   Progress progress(this, 0.0, 1.0, 2);
 
-  // We require a copy of the workspace if the
-  auto inPlace = outputWS == inputWS;
-  MatrixWorkspace_sptr bufferWS;
+  // If there are any Dx values in the input workspace, keep a reference to
+  // them so they can be set on the output. We check only the first spectrum.
+  // Holding the shared Dx only, rather than a copy of the whole workspace,
+  // leaves Y and E unshared so an in-place operation does not copy them.
+  std::vector<Kernel::cow_ptr<HistogramData::HistogramDx>> dxs;
+  if (hasDx) {
+    dxs.reserve(inputWS->getNumberHistograms());
+    for (size_t index = 0; index < inputWS->getNumberHistograms(); ++index) {
+      dxs.emplace_back(inputWS->sharedDx(index));
+    }
+  }
 
   if (op == "Multiply") {
 
     progress.report("Multiplying factor...");
 
     if (outputWS == inputWS) {
-      if (hasDx) {
-        bufferWS = inputWS->clone();
-      }
       inputWS *= factor;
     } else {
       outputWS = inputWS * factor;
@@ -59,9 +64,6 @@ void Scale::exec() {
     progress.report("Adding factor...");
 
     if (outputWS == inputWS) {
-      if (hasDx) {
-        bufferWS = inputWS->clone();
-      }
       inputWS += factor;
     } else {
       outputWS = inputWS + factor;
@@ -70,15 +72,8 @@ void Scale::exec() {
 
   progress.report();
 
-  // If there are any Dx values in the input workspace, then
-  // copy them across. We check only the first spectrum.
-  if (hasDx) {
-    if (!inPlace) {
-      bufferWS = inputWS;
-    }
-    for (size_t index = 0; index < bufferWS->getNumberHistograms(); ++index) {
-      outputWS->setSharedDx(index, bufferWS->sharedDx(index));
-    }
+  for (size_t index = 0; index < dxs.size(); ++index) {
+    outputWS->setSharedDx(index, dxs[index]);
   }
 
   setProperty("OutputWorkspace", outputWS);
@@ -8,6 +8,8 @@
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitConversion.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Algorithms {
 /** The procedure analyses emode and efixed properties provided to the algorithm
@@ -104,6 +106,41 @@ double SofQCommon::q(const double deltaE, const double twoTheta,
   return indirectQ(deltaE, twoTheta, det);
 }
 
+/**
+ * Calculate the Q values for a number of energy transfers at the same
+ * scattering angle. This gives the same values as calling q() for each
+ * energy transfer but looks up EFixed and computes the cosine only once.
+ * @param deltaE The energy transfers in meV
+ * @param twoTheta The scattering angle in radians
+ * @param det A pointer to the corresponding detector, can be nullptr
+ *        for direct emode.
+ * @return The momentum transfers in A-1
+ */
+std::vector<double> SofQCommon::qValues(const std::vector<double> &deltaE,
+                                        const double twoTheta,
+                                        const Geometry::IDetector *det) const {
+  using Mantid::PhysicalConstants::E_mev_toNeutronWavenumberSq;
+  const bool direct = m_emode == 1;
+  if (!direct && !det) {
+    throw std::runtime_error("indirectQ: det is nullptr.");
+  }
+  const double efixed = direct ? m_efixed : getEFixed(*det);
+  const double kfixed = std::sqrt(efixed / E_mev_toNeutronWavenumberSq);
+  const double cosTwoTheta = std::cos(twoTheta);
+  std::vector<double> qs(deltaE.size());
+  std::transform(
+      deltaE.cbegin(), deltaE.cend(), qs.begin(), [&](const double dE) {
+        const double ki =
+            direct ? kfixed
+                   : std::sqrt((efixed + dE) / E_mev_toNeutronWavenumberSq);
+        const double kf =
+            direct ? std::sqrt((efixed - dE) / E_mev_toNeutronWavenumberSq)
+                   : kfixed;
+        return std::sqrt(ki * ki + kf * kf - 2. * ki * kf * cosTwoTheta);
+      });
+  return qs;
+}
+
 /**
  * Return a pair of (minimum Q, maximum Q) for given workspace.
  * @param ws a workspace
@@ -124,6 +124,12 @@ void SofQWNormalisedPolygon::exec() {
 
     const auto specNo = static_cast<specnum_t>(inputIndices.spectrumNumber(i));
     std::stringstream logStream;
+    std::vector<MantidVec::difference_type> qIndices;
+    // Q at all energy bin edges along the lower and upper angle
+    const auto qLower =
+        m_EmodeProperties.qValues(X.rawData(), thetaLower, det);
+    const auto qUpper =
+        m_EmodeProperties.qValues(X.rawData(), thetaUpper, det);
     for (size_t j = 0; j < nEnergyBins; ++j) {
       m_progress->report("Computing polygon intersections");
       // For each input polygon test where it intersects with
@@ -131,12 +137,12 @@ void SofQWNormalisedPolygon::exec() {
       const double dE_j = X[j];
       const double dE_jp1 = X[j + 1];
 
-      const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
+      const double lrQ = qLower[j + 1];
 
-      const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
+      const V2D ll(dE_j, qLower[j]);
       const V2D lr(dE_jp1, lrQ);
-      const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
-      const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
+      const V2D ur(dE_jp1, qUpper[j + 1]);
+      const V2D ul(dE_j, qUpper[j]);
       if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
         logStream << "Spectrum=" << specNo << ", theta=" << theta
                   << ",thetaWidth=" << thetaWidth << ", phi=" << phi
@@ -152,20 +158,24 @@ void SofQWNormalisedPolygon::exec() {
       // Find which q bin this point lies in
       const MantidVec::difference_type qIndex =
           std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
-      if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(
-              spectrumInfo.spectrumDefinition(i)[0].first);
-        }
-      }
+      if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size()))
+        qIndices.push_back(qIndex - 1);
     }
     if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
       g_log.debug(logStream.str());
     }
+    // Add this spectra-detector pair to the mapping of all q bins it
+    // contributes to
+    std::sort(qIndices.begin(), qIndices.end());
+    qIndices.erase(std::unique(qIndices.begin(), qIndices.end()),
+                   qIndices.end());
+    PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
+      // Could do a more complete merge of spectrum definitions here, but
+      // historically only the ID of the first detector in the spectrum is
+      // used, so I am keeping that for now.
+      for (const auto qIndex : qIndices)
+        detIDMapping[qIndex].add(spectrumInfo.spectrumDefinition(i)[0].first);
+    }
 
     PARALLEL_END_INTERUPT_REGION
   }
@@ -82,6 +82,11 @@ void SofQWPolygon::exec() {
     const double thetaLower = theta - halfWidth;
     const double thetaUpper = theta + halfWidth;
 
+    // Q at all energy bin edges along the lower and upper angle
+    const auto qLower =
+        m_EmodeProperties.qValues(X.rawData(), thetaLower, det);
+    const auto qUpper =
+        m_EmodeProperties.qValues(X.rawData(), thetaUpper, det);
     for (size_t j = 0; j < nenergyBins; ++j) {
       m_progress->report("Computing polygon intersections");
       // For each input polygon test where it intersects with
@@ -89,12 +94,12 @@ void SofQWPolygon::exec() {
       const double dE_j = X[j];
       const double dE_jp1 = X[j + 1];
 
-      const double lrQ = m_EmodeProperties.q(dE_jp1, thetaLower, det);
+      const double lrQ = qLower[j + 1];
 
-      const V2D ll(dE_j, m_EmodeProperties.q(dE_j, thetaLower, det));
+      const V2D ll(dE_j, qLower[j]);
       const V2D lr(dE_jp1, lrQ);
-      const V2D ur(dE_jp1, m_EmodeProperties.q(dE_jp1, thetaUpper, det));
-      const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
+      const V2D ur(dE_jp1, qUpper[j + 1]);
+      const V2D ul(dE_j, qUpper[j]);
       Quadrilateral inputQ = Quadrilateral(ll, lr, ur, ul);
 
       DataObjects::FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j,
@@ -12,6 +12,7 @@
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <algorithm>
 #include <numeric>
 
 namespace Mantid {
@@ -21,6 +22,74 @@ DECLARE_ALGORITHM(SumEventsByLogValue)
 
 using namespace Kernel;
 using namespace API;
+using Types::Core::DateAndTime;
+
+namespace {
+/** Finds the entry of a log that applies at the given time. This is the entry
+ * whose value TimeSeriesProperty::getSingleValue would return.
+ * @param times :: The sorted times of the log entries
+ * @param time :: The time to look up
+ * @param hint :: An entry to check first, e.g. the one found for the previous
+ * event, as consecutive events mostly fall between the same two log entries
+ * @return The index of the log entry
+ */
+size_t logIndexAt(const std::vector<DateAndTime> &times,
+                  const DateAndTime &time, const size_t hint) {
+  if (hint + 1 < times.size() && times[hint] < time && time < times[hint + 1])
+    return hint;
+  if (time < times.front())
+    return 0;
+  if (time >= times.back())
+    return times.size() - 1;
+  const auto it = std::lower_bound(times.cbegin(), times.cend(), time);
+  auto index = static_cast<size_t>(std::distance(times.cbegin(), it));
+  if (*it > time)
+    --index;
+  return index;
+}
+
+/** Counts events by the value of a log at their pulse times. Events in a row
+ * that fall at the same log entry are counted locally, so the shared output
+ * is only updated once for each such run rather than once per event.
+ * @param pulseTimes :: The pulse times of the events
+ * @param logTimes :: The sorted times of the log entries
+ * @param logValues :: The values of the log entries
+ * @param binOf :: Gives the output index of a log value, or -1 to skip it
+ * @param Y :: The output counts
+ */
+template <typename T, typename BinFunction, typename YType>
+void countByLogValue(const std::vector<DateAndTime> &pulseTimes,
+                     const std::vector<DateAndTime> &logTimes,
+                     const std::vector<T> &logValues, BinFunction binOf,
+                     YType &Y) {
+  if (logTimes.empty())
+    return;
+  const auto addCounts = [&Y](const int bin, const int count) {
+    if (bin >= 0 && count > 0) {
+      PARALLEL_ATOMIC
+      Y[bin] += count;
+    }
+  };
+
+  size_t logIndex = 0;
+  size_t runIndex = logTimes.size();
+  int bin = -1;
+  int count = 0;
+  for (const auto &pulseTime : pulseTimes) {
+    // This algorithm is really concerned with 'slow' logs so we don't care
+    // about the time of the event within the pulse.
+    logIndex = logIndexAt(logTimes, pulseTime, logIndex);
+    if (logIndex != runIndex) {
+      addCounts(bin, count);
+      runIndex = logIndex;
+      bin = binOf(logValues[logIndex]);
+      count = 0;
+    }
+    ++count;
+  }
+  addCounts(bin, count);
+}
+} // namespace
 
 void SumEventsByLogValue::init() {
   declareProperty(
@@ -147,13 +216,16 @@ void SumEventsByLogValue::createTableOutput(
 
   // Accumulate things in a local vector before transferring to the table
   std::vector<int> Y(xLength);
+  // Copy the log once rather than looking up every event through it
+  const auto seriesTimes = log->timesAsVector();
+  const auto seriesValues = log->valuesAsVector();
   const int numSpec = static_cast<int>(m_inputWorkspace->getNumberHistograms());
   Progress prog(this, 0.0, 1.0, numSpec + xLength);
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWorkspace))
   for (int spec = 0; spec < numSpec; ++spec) {
     PARALLEL_START_INTERUPT_REGION
     const IEventList &eventList = m_inputWorkspace->getSpectrum(spec);
-    filterEventList(eventList, minVal, maxVal, log, Y);
+    filterEventList(eventList, minVal, maxVal, seriesTimes, seriesValues, Y);
     prog.report();
     PARALLEL_END_INTERUPT_REGION
   }
@@ -180,7 +252,8 @@ void SumEventsByLogValue::createTableOutput(
   }
 
   // Columns for normalisation: monitors (if available), time & proton charge
-  addMonitorCounts(outputWorkspace, log, minVal, maxVal);
+  addMonitorCounts(outputWorkspace, seriesTimes, seriesValues, minVal,
+                   maxVal);
   // Add a column to hold the time duration (in seconds) for which the log had a
   // certain value
   auto timeCol = outputWorkspace->addColumn("double", "time");
@@ -262,44 +335,38 @@ void SumEventsByLogValue::createTableOutput(
  *  @param eventList The event list to parse
  *  @param minVal    The minimum value of the log
  *  @param maxVal    The maximum value of the log
- *  @param log       The TimeSeriesProperty log
+ *  @param logTimes  The sorted times of the TimeSeriesProperty log
+ *  @param logValues The values of the TimeSeriesProperty log
  *  @param Y         The output vector to be filled
  */
 void SumEventsByLogValue::filterEventList(
     const API::IEventList &eventList, const int minVal, const int maxVal,
-    const Kernel::TimeSeriesProperty<int> *log, std::vector<int> &Y) {
-  if (log->realSize() == 0)
-    return;
-
-  const auto pulseTimes = eventList.getPulseTimes();
-  for (auto pulseTime : pulseTimes) {
-    // Find the value of the log at the time of this event
-    // This algorithm is really concerned with 'slow' logs so we don't care
-    // about
-    // the time of the event within the pulse.
-    // NB: If the pulse time is before the first log entry, we get the first
-    // value.
-    const int logValue = log->getSingleValue(pulseTime);
-
-    if (logValue >= minVal && logValue <= maxVal) {
-      // In this scenario it's easy to know what bin to increment
-      PARALLEL_ATOMIC
-      ++Y[logValue - minVal];
-    }
-  }
+    const std::vector<Types::Core::DateAndTime> &logTimes,
+    const std::vector<int> &logValues, std::vector<int> &Y) {
+  // NB: If the pulse time is before the first log entry, we get the first
+  // value. In this scenario it's easy to know what bin to increment.
+  countByLogValue(eventList.getPulseTimes(), logTimes, logValues,
+                  [minVal, maxVal](const int logValue) {
+                    return (logValue >= minVal && logValue <= maxVal)
+                               ? logValue - minVal
+                               : -1;
+                  },
+                  Y);
 }
 
 /** Looks for monitor event data and, if found, adds columns to the output table
  * corresponding
  *  to the monitor counts for each (integer) log value.
  *  @param outputWorkspace The output table
- *  @param log             The log being summed against
+ *  @param logTimes        The sorted times of the log being summed against
+ *  @param logValues       The values of the log being summed against
  *  @param minVal          The minimum value of the log
  *  @param maxVal          The maximum value of the log
  */
-void SumEventsByLogValue::addMonitorCounts(ITableWorkspace_sptr outputWorkspace,
-                                           const TimeSeriesProperty<int> *log,
-                                           const int minVal, const int maxVal) {
+void SumEventsByLogValue::addMonitorCounts(
+    ITableWorkspace_sptr outputWorkspace,
+    const std::vector<Types::Core::DateAndTime> &logTimes,
+    const std::vector<int> &logValues, const int minVal, const int maxVal) {
   DataObjects::EventWorkspace_const_sptr monitorWorkspace =
       getProperty("MonitorWorkspace");
   // If no monitor workspace was given, there's nothing to do
@@ -320,7 +387,7 @@ void SumEventsByLogValue::addMonitorCounts(ITableWorkspace_sptr outputWorkspace,
       // Accumulate things in a local vector before transferring to the table
       // workspace
       std::vector<int> Y(xLength);
-      filterEventList(eventList, minVal, maxVal, log, Y);
+      filterEventList(eventList, minVal, maxVal, logTimes, logValues, Y);
       // Transfer the results to the table
       for (int i = 0; i < xLength; ++i) {
         monitorCounts->cell<int>(i) = Y[i];
@@ -418,21 +485,23 @@ void SumEventsByLogValue::createBinnedOutput(
   outputWorkspace->setYUnit("Counts");
 
   auto &Y = outputWorkspace->mutableY(0);
+  // Copy the log once rather than looking up every event through it
+  const auto logTimes = log->timesAsVector();
+  const auto logValues = log->valuesAsVector();
+  const auto binOf = [&XValues](const T value) {
+    const double logValue = static_cast<double>(value);
+    if (logValue >= XValues.front() && logValue < XValues.back())
+      return VectorHelper::getBinIndex(XValues, logValue);
+    return -1;
+  };
   const int numSpec = static_cast<int>(m_inputWorkspace->getNumberHistograms());
   Progress prog(this, 0.0, 1.0, numSpec);
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWorkspace))
   for (int spec = 0; spec < numSpec; ++spec) {
     PARALLEL_START_INTERUPT_REGION
     const IEventList &eventList = m_inputWorkspace->getSpectrum(spec);
-    const auto pulseTimes = eventList.getPulseTimes();
-    for (auto pulseTime : pulseTimes) {
-      // Find the value of the log at the time of this event
-      const double logValue = log->getSingleValue(pulseTime);
-      if (logValue >= XValues.front() && logValue < XValues.back()) {
-        PARALLEL_ATOMIC
-        ++Y[VectorHelper::getBinIndex(XValues, logValue)];
-      }
-    }
+    // Find the value of the log at the time of each event
+    countByLogValue(eventList.getPulseTimes(), logTimes, logValues, binOf, Y);
 
     prog.report();
     PARALLEL_END_INTERUPT_REGION
@@ -605,6 +605,8 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
   outputEL.clearDetectorIDs();
 
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
+  std::vector<const EventList *> inputLists;
+  inputLists.reserve(m_indices.size());
   // Loop over spectra
   for (const auto i : m_indices) {
     if (spectrumInfo.hasDetectors(i)) {
@@ -619,15 +621,16 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
     }
     numSpectra++;
 
-    // Add the event lists with the operator
     const EventList &inputEL = inputWorkspace->getSpectrum(i);
     if (inputEL.empty()) {
       ++numZeros;
     }
-    outputEL += inputEL;
+    inputLists.push_back(&inputEL);
 
     progress.report();
   }
+  // Add all event lists in one go, which keeps sorted input sorted
+  outputEL.addEventLists(inputLists);
 }
 
 } // namespace Algorithms
@@ -41,8 +41,9 @@ void UnaryOperation::exec() {
   }
 
   MatrixWorkspace_sptr out_work = getProperty(outputPropName());
+  const bool inPlace = out_work == in_work;
   // Only create output workspace if different to input one
-  if (out_work != in_work) {
+  if (!inPlace) {
     if (in_work->id() == "EventWorkspace") {
       // Handles case of EventList which needs to be converted to Workspace2D
       out_work = WorkspaceFactory::Instance().create(in_work);
@@ -66,6 +67,11 @@ void UnaryOperation::exec() {
   PARALLEL_FOR_IF(Kernel::threadSafe(*in_work, *out_work))
   for (int64_t i = 0; i < int64_t(numSpec); ++i) {
     PARALLEL_START_INTERUPT_REGION
+    if (inPlace) {
+      execInPlace(*out_work, i);
+      progress.report();
+      continue;
+    }
     // Copy the X values over
     out_work->setSharedX(i, in_work->sharedX(i));
     // Get references to the data
@@ -88,6 +94,41 @@ void UnaryOperation::exec() {
   PARALLEL_CHECK_INTERUPT_REGION
 }
 
+/**
+ * Carries out the operation on a single spectrum of a workspace that is both
+ * input and output. Write access to Y and E, which copies them if they are
+ * shared with other spectra or workspaces, is only taken once the operation
+ * changes a value, so unchanged data are left as they are.
+ * @param workspace :: The workspace to modify
+ * @param index :: The workspace index of the spectrum
+ */
+void UnaryOperation::execInPlace(MatrixWorkspace &workspace,
+                                 const size_t index) {
+  const auto X = workspace.points(index);
+  const auto &Y = workspace.y(index);
+  const auto &E = workspace.e(index);
+  const size_t specSize = Y.size();
+  size_t j = 0;
+  for (; j < specSize; ++j) {
+    double y;
+    double e;
+    performUnaryOperation(X[j], Y[j], E[j], y, e);
+    if (y != Y[j] || e != E[j]) {
+      break;
+    }
+  }
+  if (j == specSize) {
+    return;
+  }
+  // Y and E may be replaced by private copies here, so only access the data
+  // through the mutable references from now on.
+  auto &YOut = workspace.mutableY(index);
+  auto &EOut = workspace.mutableE(index);
+  for (; j < specSize; ++j) {
+    performUnaryOperation(X[j], YOut[j], EOut[j], YOut[j], EOut[j]);
+  }
+}
+
 /// Executes the algorithm for events
 void UnaryOperation::execEvent() {
   g_log.information("Processing event workspace");
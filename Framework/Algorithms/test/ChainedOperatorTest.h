@@ -65,6 +65,27 @@ public:
     performTest(work_in1, work_in2);
   }
 
+  void test_temporary_results_are_reused() {
+    MatrixWorkspace_sptr work_in1 =
+        WorkspaceCreationHelper::create2DWorkspace123(10, 20);
+    MatrixWorkspace_sptr work_in2 =
+        WorkspaceCreationHelper::create2DWorkspace154(10, 20);
+
+    MatrixWorkspace_sptr sum = work_in1 + work_in2;
+    TS_ASSERT_DIFFERS(sum, work_in1);
+    const auto *sumAddress = sum.get();
+    // An unnamed temporary only referenced by the operator holds the result
+    MatrixWorkspace_sptr work_out1 = std::move(sum) / 3.0 + 5.0;
+    TS_ASSERT_EQUALS(work_out1.get(), sumAddress);
+    checkData(work_in1, work_in2, work_out1);
+
+    // Workspaces still referenced elsewhere are never overwritten
+    MatrixWorkspace_sptr scaled = work_out1 * 2.0;
+    TS_ASSERT_DIFFERS(scaled, work_out1);
+    checkData(work_in1, work_in2, work_out1);
+    TS_ASSERT_DELTA(scaled->y(0)[0], 2.0 * work_out1->y(0)[0], 1e-12);
+  }
+
   void performTest(MatrixWorkspace_sptr work_in1,
                    MatrixWorkspace_sptr work_in2) {
     ComplexOpTest alg;
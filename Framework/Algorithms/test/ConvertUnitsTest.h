@@ -8,6 +8,7 @@
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidAlgorithms/ConvertToDistribution.h"
 #include "MantidAlgorithms/ConvertUnits.h"
 #include "MantidDataHandling/LoadInstrument.h"
@@ -817,6 +818,35 @@ public:
     AnalysisDataService::Instance().remove(wsName);
   }
 
+  void test_each_spectrum_is_converted_with_its_own_geometry() {
+    MatrixWorkspace_sptr ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(20, 10);
+
+    ConvertUnits conv;
+    conv.setChild(true);
+    conv.initialize();
+    conv.setProperty("InputWorkspace", ws);
+    conv.setPropertyValue("OutputWorkspace", "unused_for_child");
+    conv.setPropertyValue("Target", "dSpacing");
+    TS_ASSERT_THROWS_NOTHING(conv.execute());
+    TS_ASSERT(conv.isExecuted());
+    MatrixWorkspace_sptr out = conv.getProperty("OutputWorkspace");
+
+    const auto &spectrumInfo = ws->spectrumInfo();
+    std::vector<double> emptyVec;
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      auto expected = ws->x(i).rawData();
+      auto dSpacing = UnitFactory::Instance().create("dSpacing");
+      dSpacing->fromTOF(expected, emptyVec, spectrumInfo.l1(),
+                        spectrumInfo.l2(i), spectrumInfo.twoTheta(i), 0, 0.,
+                        0.);
+      TS_ASSERT_EQUALS(out->x(i).size(), expected.size());
+      for (size_t j = 0; j < expected.size(); ++j) {
+        TS_ASSERT_DELTA(out->x(i)[j], expected[j], 1e-12);
+      }
+    }
+  }
+
 private:
   ConvertUnits alg;
   std::string inputSpace;
@@ -96,6 +96,67 @@ public:
     dotestEventWorkspace(false, 1, false);
   }
 
+  void test_EventWorkspace_mixed_event_types() {
+    const std::string wsName("DiffractionFocussing2Test_mixed");
+    EventWorkspace_sptr inputW =
+        WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(3, 4);
+    inputW->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+    for (size_t pix = 0; pix < inputW->getNumberHistograms(); pix++) {
+      inputW->setHistogram(pix, BinEdges{1.0, 2.0, 1e6});
+      auto &eventList = inputW->getSpectrum(pix);
+      for (size_t i = 0; i <= pix % 3; ++i)
+        eventList.addEventQuickly(TofEvent(static_cast<double>(100 * pix + i)));
+      // Some of the lists carry weights
+      if (pix % 5 == 0)
+        eventList *= 2.0;
+    }
+    AnalysisDataService::Instance().addOrReplace(wsName, inputW);
+    const std::string groupWSName("DiffractionFocussing2Test_mixed_group");
+    FrameworkManager::Instance().exec("CreateGroupingWorkspace", 6,
+                                      "InputWorkspace", wsName.c_str(),
+                                      "GroupNames", "bank1,bank3",
+                                      "OutputWorkspace", groupWSName.c_str());
+
+    DiffractionFocussing2 alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace", wsName);
+    alg.setPropertyValue("OutputWorkspace", wsName + "_focussed");
+    alg.setPropertyValue("GroupingWorkspace", groupWSName);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    auto output = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        wsName + "_focussed");
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 2);
+    for (size_t group = 0; group < output->getNumberHistograms(); ++group) {
+      const auto &groupEvents = output->getSpectrum(group);
+      TS_ASSERT_EQUALS(groupEvents.getEventType(), WEIGHTED);
+      // Events are in the order of the input spectra of the group
+      std::vector<WeightedEvent> expected;
+      for (size_t pix = 0; pix < inputW->getNumberHistograms(); pix++) {
+        const auto &eventList = inputW->getSpectrum(pix);
+        if (groupEvents.hasDetectorID(*eventList.getDetectorIDs().begin())) {
+          EventList weighted(eventList);
+          weighted.switchTo(WEIGHTED);
+          const auto &events = weighted.getWeightedEvents();
+          expected.insert(expected.end(), events.begin(), events.end());
+        }
+      }
+      TS_ASSERT_EQUALS(groupEvents.getDetectorIDs().size(), 16);
+      TS_ASSERT_EQUALS(groupEvents.getNumberEvents(), expected.size());
+      if (groupEvents.getNumberEvents() != expected.size())
+        continue;
+      const auto &events = groupEvents.getWeightedEvents();
+      for (size_t i = 0; i < expected.size(); ++i) {
+        TS_ASSERT_EQUALS(events[i].tof(), expected[i].tof());
+        TS_ASSERT_EQUALS(events[i].weight(), expected[i].weight());
+      }
+    }
+    AnalysisDataService::Instance().remove(wsName);
+    AnalysisDataService::Instance().remove(wsName + "_focussed");
+    AnalysisDataService::Instance().remove(groupWSName);
+  }
+
   void dotestEventWorkspace(bool inplace, size_t numgroups,
                             bool preserveEvents = true,
                             int bankWidthInPixels = 16) {
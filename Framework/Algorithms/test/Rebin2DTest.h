@@ -121,6 +121,22 @@ public:
     checkData(outputWS, 6, 10, false, true, true);
   }
 
+  void test_Rebin2D_With_Output_Range_Inside_Input() {
+    MatrixWorkspace_sptr inputWS = makeInputWS(false); // 10 histograms, 10 bins
+    MatrixWorkspace_sptr outputWS =
+        runAlgorithm(inputWS, "6.5,1.,9.5", "0.5,1,4.5");
+    TS_ASSERT_EQUALS(outputWS->getNumberHistograms(), 4);
+    TS_ASSERT_EQUALS(outputWS->blocksize(), 3);
+    // Each output bin covers exactly one input bin split across two columns,
+    // input lying outside the output range must not contribute
+    for (size_t i = 0; i < outputWS->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < outputWS->blocksize(); ++j) {
+        TS_ASSERT_DELTA(outputWS->y(i)[j], 2.0, 1e-12);
+        TS_ASSERT_DELTA(outputWS->e(i)[j], std::sqrt(2.0), 1e-12);
+      }
+    }
+  }
+
   void test_BothAxes() {
     // 5,6,7,8,9,10,11,12,12,14,15
     MatrixWorkspace_sptr inputWS =
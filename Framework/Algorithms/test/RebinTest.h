@@ -522,6 +522,58 @@ public:
     do_test_FullBinsOnly(params, yExpected, xExpected);
   }
 
+  void test_empty_spectra_share_data() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(3, 10);
+    for (size_t i = 1; i < 3; ++i) {
+      ws->mutableY(i) = 0.0;
+      ws->mutableE(i) = 0.0;
+    }
+    auto outWS = runRebin(ws, "0,2,10");
+    TS_ASSERT_EQUALS(&outWS->y(1), &outWS->y(2));
+    TS_ASSERT_EQUALS(&outWS->e(1), &outWS->e(2));
+    TS_ASSERT_DIFFERS(&outWS->y(0), &outWS->y(1));
+    TS_ASSERT_EQUALS(outWS->y(1).size(), 5);
+    TS_ASSERT_EQUALS(outWS->y(1)[0], 0.0);
+    TS_ASSERT_EQUALS(outWS->e(2)[4], 0.0);
+    TS_ASSERT_DELTA(outWS->y(0)[0], 4.0, 1e-12);
+  }
+
+  void test_empty_spectra_with_invalid_bin_edges_throw() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(2, 10);
+    ws->mutableY(1) = 0.0;
+    ws->mutableE(1) = 0.0;
+    ws->mutableX(1)[5] = ws->x(1)[4];
+    Rebin rebin;
+    rebin.setChild(true);
+    rebin.initialize();
+    rebin.setProperty("InputWorkspace", ws);
+    rebin.setPropertyValue("OutputWorkspace", "out");
+    rebin.setPropertyValue("Params", "0,2,10");
+    rebin.setProperty("IgnoreBinErrors", false);
+    TS_ASSERT_THROWS(rebin.execute(), std::runtime_error);
+    TS_ASSERT(!rebin.isExecuted());
+
+    rebin.setProperty("IgnoreBinErrors", true);
+    TS_ASSERT_THROWS_NOTHING(rebin.execute());
+    MatrixWorkspace_sptr outWS = rebin.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(outWS->y(1)[2], 0.0);
+    TS_ASSERT_DELTA(outWS->y(0)[2], 4.0, 1e-12);
+  }
+
+  void test_empty_event_lists_share_data() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10);
+    ws->getSpectrum(1).clear(false);
+    ws->getSpectrum(2).clear(false);
+    auto outWS = runRebin(ws, "0,2,10", false);
+    TS_ASSERT_EQUALS(&outWS->y(1), &outWS->y(2));
+    TS_ASSERT_EQUALS(&outWS->e(1), &outWS->e(2));
+    TS_ASSERT_DIFFERS(&outWS->y(0), &outWS->y(1));
+    TS_ASSERT_EQUALS(outWS->y(2).size(), 5);
+    TS_ASSERT_EQUALS(outWS->y(2)[1], 0.0);
+    TS_ASSERT_EQUALS(outWS->e(1)[3], 0.0);
+    TS_ASSERT_DIFFERS(outWS->y(0)[0], 0.0);
+  }
+
   void test_parallel_cloned() {
     ParallelTestHelpers::runParallel(run_rebin,
                                      "Parallel::StorageMode::Cloned");
@@ -547,6 +599,21 @@ public:
   }
 
 private:
+  MatrixWorkspace_sptr runRebin(const MatrixWorkspace_sptr &inputWS,
+                                const std::string &params,
+                                const bool preserveEvents = true) {
+    Rebin rebin;
+    rebin.setChild(true);
+    rebin.initialize();
+    rebin.setProperty("InputWorkspace", inputWS);
+    rebin.setPropertyValue("OutputWorkspace", "out");
+    rebin.setPropertyValue("Params", params);
+    rebin.setProperty("PreserveEvents", preserveEvents);
+    rebin.execute();
+    TS_ASSERT(rebin.isExecuted());
+    return rebin.getProperty("OutputWorkspace");
+  }
+
   Workspace2D_sptr Create1DWorkspace(int size) {
     auto retVal = createWorkspace<Workspace2D>(1, size, size - 1);
     double j = 1.0;
@@ -329,6 +329,35 @@ public:
     AnalysisDataService::Instance().remove("test_ev_rep_out");
   }
 
+  void test_in_place_leaves_unchanged_shared_data_alone() {
+    MatrixWorkspace_sptr ws = WorkspaceCreationHelper::create2DWorkspace(3, 4);
+    ws->setSharedY(1, ws->sharedY(0));
+    ws->setSharedE(1, ws->sharedE(0));
+    ws->mutableY(2)[1] = std::numeric_limits<double>::quiet_NaN();
+    const auto *sharedY = &ws->y(0);
+    const auto *ownY = &ws->y(2);
+
+    Mantid::Algorithms::ReplaceSpecialValues replace;
+    replace.setChild(true);
+    replace.initialize();
+    replace.setProperty("InputWorkspace", ws);
+    replace.setProperty("OutputWorkspace", ws);
+    replace.setPropertyValue("NaNValue", "-99.0");
+    TS_ASSERT_THROWS_NOTHING(replace.execute());
+    TS_ASSERT(replace.isExecuted());
+
+    MatrixWorkspace_sptr result = replace.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(result, ws);
+    // Spectra without special values still share their data
+    TS_ASSERT_EQUALS(&ws->y(0), sharedY);
+    TS_ASSERT_EQUALS(&ws->y(1), sharedY);
+    // Unshared data are modified without being copied
+    TS_ASSERT_EQUALS(&ws->y(2), ownY);
+    TS_ASSERT_EQUALS(ws->y(2)[1], -99.0);
+    TS_ASSERT_EQUALS(ws->e(2)[1], 0.0);
+    TS_ASSERT_EQUALS(ws->y(2)[0], 2.0);
+  }
+
 private:
   Mantid::Algorithms::ReplaceSpecialValues alg;
 
@@ -103,6 +103,34 @@ public:
     doTestScaleWithDx("Add", outputWorkspaceIsInputWorkspace);
   }
 
+  void test_in_place_with_dx_values_does_not_copy_data() {
+    Mantid::API::MatrixWorkspace_sptr ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithValuesAndXerror(
+            3, 5, true, 1.0, 2.0, 0.5, 0.1);
+    std::vector<const Mantid::HistogramData::HistogramY *> ys;
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      // Make sure the data are not shared between spectra
+      ys.push_back(&ws->mutableY(i));
+      ws->mutableE(i);
+    }
+
+    Mantid::Algorithms::Scale alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", ws);
+    alg.setProperty("OutputWorkspace", ws);
+    alg.setProperty("Factor", 10.0);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(&ws->y(i), ys[i]);
+      TS_ASSERT_DELTA(ws->y(i)[0], 20.0, 1e-12);
+      TS_ASSERT(ws->hasDx(i));
+      TS_ASSERT_DELTA(ws->dx(i)[0], 0.1, 1e-12);
+    }
+  }
+
 private:
   void testScaleFactorApplied(
       const Mantid::API::MatrixWorkspace_const_sptr &inputWS,
@@ -226,6 +226,54 @@ public:
     }
   }
 
+  void testQValuesDirect() {
+    using namespace Mantid;
+    using namespace WorkspaceCreationHelper;
+    Algorithms::SofQW alg;
+    alg.initialize();
+    alg.setProperty("EMode", "Direct");
+    Algorithms::SofQCommon s;
+    auto ws = create2DWorkspaceWithFullInstrument(5, 1);
+    const auto Ei = 4.2;
+    ws->mutableRun().addProperty("Ei", Ei);
+    s.initCachedValues(*ws, &alg);
+    const std::vector<double> deltaE{-3.1, -1.2, 0., 0.7, 2.5};
+    const auto &detectorInfo = ws->detectorInfo();
+    for (size_t i = 0; i < detectorInfo.size(); ++i) {
+      const auto twoTheta = detectorInfo.twoTheta(i);
+      const auto qs = s.qValues(deltaE, twoTheta, nullptr);
+      TS_ASSERT_EQUALS(qs.size(), deltaE.size())
+      for (size_t j = 0; j < deltaE.size(); ++j) {
+        TS_ASSERT_EQUALS(qs[j], s.q(deltaE[j], twoTheta, nullptr))
+      }
+    }
+  }
+
+  void testQValuesIndirect() {
+    using namespace Mantid;
+    using namespace WorkspaceCreationHelper;
+    Algorithms::SofQW alg;
+    alg.initialize();
+    alg.setProperty("EMode", "Indirect");
+    Algorithms::SofQCommon s;
+    auto ws = create2DWorkspaceWithFullInstrument(2, 1);
+    setEFixed(ws, "pixel-0)", 3.7);
+    setEFixed(ws, "pixel-1)", 2.3);
+    s.initCachedValues(*ws, &alg);
+    const std::vector<double> deltaE{-1.8, -0.9, 0., 1.1, 4.6};
+    const auto &detectorInfo = ws->detectorInfo();
+    for (size_t i = 0; i < detectorInfo.size(); ++i) {
+      const auto &det = detectorInfo.detector(i);
+      const auto twoTheta = detectorInfo.twoTheta(i);
+      const auto qs = s.qValues(deltaE, twoTheta, &det);
+      TS_ASSERT_EQUALS(qs.size(), deltaE.size())
+      for (size_t j = 0; j < deltaE.size(); ++j) {
+        TS_ASSERT_EQUALS(qs[j], s.q(deltaE[j], twoTheta, &det))
+      }
+    }
+    TS_ASSERT_THROWS(s.qValues(deltaE, 0.5, nullptr), std::runtime_error)
+  }
+
 private:
   static double k(const double E) {
     using namespace Mantid;
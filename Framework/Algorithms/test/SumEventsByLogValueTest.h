@@ -132,6 +132,40 @@ public:
     // Save more complex tests for a system test
   }
 
+  void test_integer_property_counts_match_log_values_at_pulse_times() {
+    EventWorkspace_sptr ws = createWorkspace();
+    // A log with entries both between and at the event pulse times, one of
+    // them repeated
+    const DateAndTime run_start("2010-01-01T00:00:00");
+    auto denseTSP = new TimeSeriesProperty<int>("denseProp");
+    for (int i = 0; i < 60; ++i) {
+      denseTSP->addValue(run_start + 5.0 + 0.5 * i, i % 7);
+    }
+    denseTSP->addValue(run_start + 12.0, 9);
+    ws->mutableRun().addProperty(denseTSP);
+
+    SumEventsByLogValue alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", ws);
+    alg.setProperty("OutputWorkspace", "outws");
+    alg.setProperty("LogName", "denseProp");
+    TS_ASSERT(alg.execute());
+
+    std::map<int, int> expected;
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      for (const auto &pulseTime : ws->getSpectrum(i).getPulseTimes()) {
+        ++expected[denseTSP->getSingleValue(pulseTime)];
+      }
+    }
+    Workspace_sptr out = alg.getProperty("OutputWorkspace");
+    auto outWS = boost::dynamic_pointer_cast<ITableWorkspace>(out);
+    TS_ASSERT_EQUALS(outWS->rowCount(), 10);
+    for (size_t row = 0; row < outWS->rowCount(); ++row) {
+      TS_ASSERT_EQUALS(outWS->Int(row, 1), expected[outWS->Int(row, 0)]);
+    }
+  }
+
 private:
   IAlgorithm_sptr setupAlg(const std::string &logName) {
     IAlgorithm_sptr alg = boost::make_shared<SumEventsByLogValue>();
@@ -72,6 +72,9 @@ private:
   Kernel::cow_ptr<std::vector<std::vector<size_t>>> m_indexMap{nullptr};
   /// For linear index -> (detector index, time index) conversions
   Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> m_indices{nullptr};
+  /// Identifies the component positions and rotations, 0 if they were
+  /// modified since the revision was last updated.
+  uint64_t m_geometryRevision = 0;
   void failIfDetectorInfoScanning() const;
   size_t linearIndex(const std::pair<size_t, size_t> &index) const;
   void initScanIntervals();
@@ -166,6 +169,9 @@ public:
   void setScanInterval(const std::pair<int64_t, int64_t> &interval);
   void merge(const ComponentInfo &other);
 
+  uint64_t geometryRevision() const;
+  void updateGeometryRevision();
+
   class Range {
   private:
     const std::vector<size_t>::const_iterator m_begin;
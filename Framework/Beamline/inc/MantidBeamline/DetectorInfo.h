@@ -33,6 +33,13 @@ class ComponentInfo;
   Splitting DetectorInfo into two classes seemed to be the safest and easiest
   solution to this.
 
+  Synchronous scans that are merged from identical geometries are stored in a
+  compact form: positions and rotations are stored only once and rigid scan
+  groups of detectors (typically a moving detector bank) are moved by a single
+  rigid-body transform per time index, see addRigidScanGroup(). Modifying
+  positions or rotations of individual detectors for a given time index
+  converts to the full time-indexed representation.
+
 
   @author Simon Heybrock
   @date 2016
@@ -103,12 +110,20 @@ public:
   void setScanInterval(const std::pair<int64_t, int64_t> &interval);
 
   void merge(const DetectorInfo &other);
+  size_t addRigidScanGroup(const std::vector<size_t> &detectorIndices);
+  void setRigidScanTransform(const size_t group, const size_t timeIndex,
+                             const Eigen::Quaterniond &rotation,
+                             const Eigen::Vector3d &translation);
+  bool isCompactScan() const;
   void setComponentInfo(ComponentInfo *componentInfo);
   bool hasComponentInfo() const;
   double l1() const;
   Eigen::Vector3d sourcePosition() const;
   Eigen::Vector3d samplePosition() const;
 
+  uint64_t geometryRevision() const;
+  void updateGeometryRevision();
+
 private:
   size_t linearIndex(const std::pair<size_t, size_t> &index) const;
   void checkNoTimeDependence() const;
@@ -118,9 +133,22 @@ private:
   std::vector<bool> buildMergeIndices(const DetectorInfo &other) const;
   std::vector<bool> buildMergeSyncScanIndices(const DetectorInfo &other) const;
   void checkSizes(const DetectorInfo &other) const;
-  void checkIdenticalIntervals(const DetectorInfo &other, const size_t index1,
-                               const size_t index2) const;
+  void
+  checkIdenticalIntervals(const DetectorInfo &other,
+                          const std::pair<size_t, size_t> &indexOther,
+                          const std::pair<size_t, size_t> &indexThis) const;
+  Eigen::Vector3d
+  compactScanPosition(const std::pair<size_t, size_t> &index) const;
+  Eigen::Quaterniond
+  compactScanRotation(const std::pair<size_t, size_t> &index) const;
+  bool canMergeCompact(const DetectorInfo &other) const;
+  void appendRigidScanTransforms(const DetectorInfo &other,
+                                 const size_t timeIndex);
+  void expandCompactScan();
   bool m_isSyncScan{true};
+  /// True if positions and rotations are stored only for a single time index
+  /// and time dependence is given by rigid scan group transforms.
+  bool m_isCompactScan{false};
 
   Kernel::cow_ptr<std::vector<bool>> m_isMonitor{nullptr};
   Kernel::cow_ptr<std::vector<bool>> m_isMasked{nullptr};
@@ -136,7 +164,19 @@ private:
   Kernel::cow_ptr<std::vector<std::vector<size_t>>> m_indexMap{nullptr};
   /// For linear index -> (detector index, time index) conversions
   Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> m_indices{nullptr};
+  /// Rigid scan group + 1 for every detector, 0 if the detector does not move
+  Kernel::cow_ptr<std::vector<size_t>> m_rigidScanGroups{nullptr};
+  size_t m_rigidScanGroupCount{0};
+  /// Rigid-body transforms, indexed by (time index * group count + group)
+  Kernel::cow_ptr<std::vector<Eigen::Quaterniond,
+                              Eigen::aligned_allocator<Eigen::Quaterniond>>>
+      m_rigidScanRotations{nullptr};
+  Kernel::cow_ptr<std::vector<Eigen::Vector3d>> m_rigidScanTranslations{
+      nullptr};
   ComponentInfo *m_componentInfo = nullptr; // Geometry::ComponentInfo owner
+  /// Identifies the detector positions and rotations, 0 if they were modified
+  /// since the revision was last updated.
+  uint64_t m_geometryRevision{0};
 };
 
 /** Returns the number of detectors in the instrument.
@@ -153,7 +193,7 @@ inline size_t DetectorInfo::size() const {
 inline bool DetectorInfo::isScanning() const {
   if (!m_positions)
     return false;
-  return size() != m_positions->size();
+  return m_isCompactScan || size() != m_positions->size();
 }
 
 /** Returns the position of the detector with given detector index.
@@ -168,6 +208,8 @@ inline Eigen::Vector3d DetectorInfo::position(const size_t index) const {
 /// Returns the position of the detector with given index.
 inline Eigen::Vector3d
 DetectorInfo::position(const std::pair<size_t, size_t> &index) const {
+  if (m_isCompactScan)
+    return compactScanPosition(index);
   return (*m_positions)[linearIndex(index)];
 }
 
@@ -183,6 +225,8 @@ inline Eigen::Quaterniond DetectorInfo::rotation(const size_t index) const {
 /// Returns the rotation of the detector with given index.
 inline Eigen::Quaterniond
 DetectorInfo::rotation(const std::pair<size_t, size_t> &index) const {
+  if (m_isCompactScan)
+    return compactScanRotation(index);
   return (*m_rotations)[linearIndex(index)];
 }
 
@@ -194,12 +238,16 @@ inline void DetectorInfo::setPosition(const size_t index,
                                       const Eigen::Vector3d &position) {
   checkNoTimeDependence();
   m_positions.access()[index] = position;
+  m_geometryRevision = 0;
 }
 
 /// Set the position of the detector with given index.
 inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index,
                                       const Eigen::Vector3d &position) {
+  if (m_isCompactScan)
+    expandCompactScan();
   m_positions.access()[linearIndex(index)] = position;
+  m_geometryRevision = 0;
 }
 
 /** Set the rotation of the detector with given detector index.
@@ -210,12 +258,25 @@ inline void DetectorInfo::setRotation(const size_t index,
                                       const Eigen::Quaterniond &rotation) {
   checkNoTimeDependence();
   m_rotations.access()[index] = rotation.normalized();
+  m_geometryRevision = 0;
 }
 
 /// Set the rotation of the detector with given index.
 inline void DetectorInfo::setRotation(const std::pair<size_t, size_t> &index,
                                       const Eigen::Quaterniond &rotation) {
+  if (m_isCompactScan)
+    expandCompactScan();
   m_rotations.access()[linearIndex(index)] = rotation.normalized();
+  m_geometryRevision = 0;
+}
+
+/** Returns a number identifying the current detector positions and rotations.
+ *
+ * Copies of a DetectorInfo share the revision until either is modified. A
+ * revision of 0 indicates that the geometry was modified since the last call
+ * to updateGeometryRevision(), i.e., it cannot be used to identify it. */
+inline uint64_t DetectorInfo::geometryRevision() const {
+  return m_geometryRevision;
 }
 
 /// Throws if this has time-dependent data.
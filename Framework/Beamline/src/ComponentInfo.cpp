@@ -2,6 +2,7 @@
 #include "MantidBeamline/DetectorInfo.h"
 #include "MantidKernel/make_cow.h"
 #include <algorithm>
+#include <atomic>
 #include <boost/make_shared.hpp>
 #include <iterator>
 #include <numeric>
@@ -12,6 +13,9 @@ namespace Mantid {
 namespace Beamline {
 
 namespace {
+/// Source of unique component geometry revisions, shared by all instances
+std::atomic<uint64_t> g_geometryRevision{0};
+
 void failMerge(const std::string &what) {
   throw std::runtime_error(std::string("Cannot merge ComponentInfo: ") + what);
 }
@@ -107,6 +111,7 @@ ComponentInfo::ComponentInfo(
                                 "instrument tree which contains same number "
                                 "components");
   }
+  updateGeometryRevision();
 }
 
 std::unique_ptr<ComponentInfo> ComponentInfo::cloneWithoutDetectorInfo() const {
@@ -270,6 +275,7 @@ void ComponentInfo::doSetPosition(const std::pair<size_t, size_t> &index,
 
   const auto componentIndex = index.first;
   const auto timeIndex = index.second;
+  m_geometryRevision = 0;
   const Eigen::Vector3d offset = newPosition - position(componentIndex);
   for (const auto &subIndex : detectorRange) {
     m_detectorInfo->setPosition(
@@ -289,6 +295,7 @@ void ComponentInfo::doSetRotation(const std::pair<size_t, size_t> &index,
 
   const auto componentIndex = index.first;
   const auto timeIndex = index.second;
+  m_geometryRevision = 0;
   const Eigen::Vector3d compPos = position(index);
   const Eigen::Quaterniond currentRotInv = rotation(index).inverse();
   const Eigen::Quaterniond rotDelta =
@@ -529,6 +536,22 @@ ComponentInfo::componentRangeInSubtree(const size_t index) const {
           m_assemblySortedComponentIndices->begin() + range.second};
 }
 
+/** Returns a number identifying the current positions and rotations of all
+ * non-detector components.
+ *
+ * Copies of a ComponentInfo share the revision until either is modified. A
+ * revision of 0 indicates that the geometry was modified since the last call
+ * to updateGeometryRevision(). Detector geometry is tracked separately by
+ * DetectorInfo::geometryRevision(). */
+uint64_t ComponentInfo::geometryRevision() const { return m_geometryRevision; }
+
+/** Assigns a new unique revision if the geometry was modified since the
+ * revision was last updated. Not thread safe. */
+void ComponentInfo::updateGeometryRevision() {
+  if (m_geometryRevision == 0)
+    m_geometryRevision = ++g_geometryRevision;
+}
+
 Eigen::Vector3d ComponentInfo::scaleFactor(const size_t componentIndex) const {
   return (*m_scaleFactors)[componentIndex];
 }
@@ -653,6 +676,7 @@ this has no time dependence prior to this operation.
 **/
 void ComponentInfo::merge(const ComponentInfo &other) {
   checkNoTimeDependence();
+  m_geometryRevision = 0;
   const auto &toMerge = buildMergeIndicesSync(other);
   for (size_t timeIndex = 0; timeIndex < other.m_scanIntervals->size();
        ++timeIndex) {
@@ -3,10 +3,16 @@
 #include "MantidKernel/make_cow.h"
 
 #include <algorithm>
+#include <atomic>
 
 namespace Mantid {
 namespace Beamline {
 
+namespace {
+/// Source of unique detector geometry revisions, shared by all instances
+std::atomic<uint64_t> g_geometryRevision{0};
+} // namespace
+
 DetectorInfo::DetectorInfo(
     std::vector<Eigen::Vector3d> positions,
     std::vector<Eigen::Quaterniond,
@@ -23,6 +29,7 @@ DetectorInfo::DetectorInfo(
   if (m_positions->size() != m_rotations->size())
     throw std::runtime_error("DetectorInfo: Position and rotations vectors "
                              "must have identical size");
+  updateGeometryRevision();
 }
 
 DetectorInfo::DetectorInfo(
@@ -71,13 +78,10 @@ bool DetectorInfo::isEquivalent(const DetectorInfo &other) const {
 
   // Positions: Absolute difference matter, so comparison is not relative.
   // Changes below 1 nm = 1e-9 m are allowed.
-  if (!(m_positions == other.m_positions) &&
-      !std::equal(m_positions->begin(), m_positions->end(),
-                  other.m_positions->begin(),
-                  [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
-                    return (a - b).norm() < 1e-9;
-                  }))
-    return false;
+  const auto equivalentPositions = [](const Eigen::Vector3d &a,
+                                      const Eigen::Vector3d &b) {
+    return (a - b).norm() < 1e-9;
+  };
   // At a distance of L = 1000 m (a reasonable upper limit for instrument sizes)
   // from the rotation center we want a difference of less than d = 1 nm = 1e-9
   // m). We have, using small angle approximation,
@@ -88,13 +92,35 @@ bool DetectorInfo::isEquivalent(const DetectorInfo &other) const {
   constexpr double L = 1000.0;
   constexpr double safety_factor = 2.0;
   const double imag_norm_max = sin(d_max / (2.0 * L * safety_factor));
+  const auto equivalentRotations = [imag_norm_max](
+      const Eigen::Quaterniond &a, const Eigen::Quaterniond &b) {
+    return (a * b.conjugate()).vec().norm() < imag_norm_max;
+  };
+
+  if (m_isCompactScan || other.m_isCompactScan) {
+    // Compact scans are always synchronous, compare position by position.
+    if (!isSyncScan() || !other.isSyncScan() ||
+        scanCount(0) != other.scanCount(0))
+      return false;
+    for (size_t timeIndex = 0; timeIndex < scanCount(0); ++timeIndex) {
+      for (size_t detIndex = 0; detIndex < size(); ++detIndex) {
+        if (!equivalentPositions(position({detIndex, timeIndex}),
+                                 other.position({detIndex, timeIndex})) ||
+            !equivalentRotations(rotation({detIndex, timeIndex}),
+                                 other.rotation({detIndex, timeIndex})))
+          return false;
+      }
+    }
+    return true;
+  }
+
+  if (!(m_positions == other.m_positions) &&
+      !std::equal(m_positions->begin(), m_positions->end(),
+                  other.m_positions->begin(), equivalentPositions))
+    return false;
   if (!(m_rotations == other.m_rotations) &&
       !std::equal(m_rotations->begin(), m_rotations->end(),
-                  other.m_rotations->begin(),
-                  [imag_norm_max](const Eigen::Quaterniond &a,
-                                  const Eigen::Quaterniond &b) {
-                    return (a * b.conjugate()).vec().norm() < imag_norm_max;
-                  }))
+                  other.m_rotations->begin(), equivalentRotations))
     return false;
   return true;
 }
@@ -107,6 +133,8 @@ bool DetectorInfo::isEquivalent(const DetectorInfo &other) const {
 size_t DetectorInfo::scanSize() const {
   if (!m_positions)
     return 0;
+  if (m_isCompactScan)
+    return size() * scanCount(0);
   return m_positions->size();
 }
 
@@ -259,26 +287,46 @@ getIndex(const Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> &indices,
  * incremented by the scan count of that detector in `this`. The relative order
  * of time indices added from `other` is preserved. If the interval for a time
  * index in `other` is identical to a corresponding interval in `this`, it is
- * ignored, i.e., no time index is added. */
+ * ignored, i.e., no time index is added.
+ *
+ * Synchronous scans are stored in compact form if the positions and rotations
+ * of `other` are identical to those of `this` (up to rigid scan group
+ * transforms), otherwise positions and rotations are stored for every time
+ * index. */
 void DetectorInfo::merge(const DetectorInfo &other) {
+  m_geometryRevision = 0;
   if (!m_scanCounts)
     initScanCounts();
   if (m_isSyncScan) {
     const auto &merge = buildMergeSyncScanIndices(other);
+    const bool compact = canMergeCompact(other);
+    if (!compact && m_isCompactScan)
+      expandCompactScan();
     for (size_t timeIndex = 0; timeIndex < other.m_scanIntervals->size();
          ++timeIndex) {
       if (!merge[timeIndex])
         continue;
       auto &scanIntervals = m_scanIntervals.access();
       auto &isMasked = m_isMasked.access();
-      auto &positions = m_positions.access();
-      auto &rotations = m_rotations.access();
       m_scanCounts.access()[0]++;
       scanIntervals.push_back((*other.m_scanIntervals)[timeIndex]);
       const size_t indexStart = other.linearIndex({0, timeIndex});
       size_t indexEnd = indexStart + size();
       isMasked.insert(isMasked.end(), other.m_isMasked->begin() + indexStart,
                       other.m_isMasked->begin() + indexEnd);
+      if (compact) {
+        appendRigidScanTransforms(other, timeIndex);
+        continue;
+      }
+      auto &positions = m_positions.access();
+      auto &rotations = m_rotations.access();
+      if (other.m_isCompactScan) {
+        for (size_t detIndex = 0; detIndex < size(); ++detIndex) {
+          positions.push_back(other.position({detIndex, timeIndex}));
+          rotations.push_back(other.rotation({detIndex, timeIndex}));
+        }
+        continue;
+      }
       positions.insert(positions.end(), other.m_positions->begin() + indexStart,
                        other.m_positions->begin() + indexEnd);
       rotations.insert(rotations.end(), other.m_rotations->begin() + indexStart,
@@ -309,6 +357,77 @@ void DetectorInfo::merge(const DetectorInfo &other) {
   m_scanCounts = std::move(scanCounts);
 }
 
+/** Adds a rigid scan group containing the detectors with given indices and
+ * returns the index of the group.
+ *
+ * All detectors in a rigid scan group move together, i.e., for every time
+ * index their positions and rotations are given by a single rigid-body
+ * transform, see setRigidScanTransform(). This requires a compact scan, i.e., a
+ * synchronous scan merged from identical geometries, and a detector can be part
+ * of at most one group. The transform of a new group is the identity. */
+size_t
+DetectorInfo::addRigidScanGroup(const std::vector<size_t> &detectorIndices) {
+  if (!m_isCompactScan)
+    throw std::runtime_error("DetectorInfo: rigid scan groups require a "
+                             "synchronous scan with identical geometry for "
+                             "all time indices.");
+  if (!m_rigidScanGroups)
+    m_rigidScanGroups = Kernel::make_cow<std::vector<size_t>>(size(), 0);
+  for (const auto detIndex : detectorIndices)
+    if (m_rigidScanGroups->at(detIndex) != 0)
+      throw std::runtime_error(
+          "DetectorInfo: detector is already part of a rigid scan group.");
+  const size_t group = m_rigidScanGroupCount++;
+  auto &groups = m_rigidScanGroups.access();
+  for (const auto detIndex : detectorIndices)
+    groups[detIndex] = group + 1;
+
+  // Insert identity transforms for the new group at every time index.
+  auto &rotations = m_rigidScanRotations.access();
+  auto &translations = m_rigidScanTranslations.access();
+  for (size_t timeIndex = 0; timeIndex < scanCount(0); ++timeIndex) {
+    const size_t index = timeIndex * m_rigidScanGroupCount + group;
+    rotations.insert(rotations.begin() + index,
+                     Eigen::Quaterniond::Identity());
+    translations.insert(translations.begin() + index,
+                        Eigen::Vector3d::Zero());
+  }
+  return group;
+}
+
+/** Set the rigid-body transform of a rigid scan group for given time index.
+ *
+ * Positions and rotations of all detectors in the group at the time index are
+ * the result of applying `rotation` followed by `translation` to the positions
+ * and rotations stored for the detectors, i.e., the transforms of different
+ * time indices are not cumulative. */
+void DetectorInfo::setRigidScanTransform(const size_t group,
+                                         const size_t timeIndex,
+                                         const Eigen::Quaterniond &rotation,
+                                         const Eigen::Vector3d &translation) {
+  if (group >= m_rigidScanGroupCount)
+    throw std::out_of_range("DetectorInfo: invalid rigid scan group index.");
+  if (timeIndex >= scanCount(0))
+    throw std::out_of_range("DetectorInfo: invalid time index.");
+  const size_t index = timeIndex * m_rigidScanGroupCount + group;
+  m_rigidScanRotations.access()[index] = rotation.normalized();
+  m_rigidScanTranslations.access()[index] = translation;
+  m_geometryRevision = 0;
+}
+
+/** Returns true if the scan is stored in compact form.
+ *
+ * In that case memory for positions and rotations does not scale with the
+ * number of time indices, see addRigidScanGroup(). */
+bool DetectorInfo::isCompactScan() const { return m_isCompactScan; }
+
+/** Assigns a new unique revision if the geometry was modified since the
+ * revision was last updated. Not thread safe. */
+void DetectorInfo::updateGeometryRevision() {
+  if (m_geometryRevision == 0)
+    m_geometryRevision = ++g_geometryRevision;
+}
+
 void DetectorInfo::setComponentInfo(ComponentInfo *componentInfo) {
   m_componentInfo = componentInfo;
 }
@@ -344,6 +463,104 @@ Eigen::Vector3d DetectorInfo::samplePosition() const {
   return m_componentInfo->samplePosition();
 }
 
+Eigen::Vector3d DetectorInfo::compactScanPosition(
+    const std::pair<size_t, size_t> &index) const {
+  const auto &position = (*m_positions)[index.first];
+  const size_t group =
+      m_rigidScanGroups ? (*m_rigidScanGroups)[index.first] : 0;
+  if (group == 0)
+    return position;
+  const size_t i = index.second * m_rigidScanGroupCount + group - 1;
+  return (*m_rigidScanRotations)[i] * position + (*m_rigidScanTranslations)[i];
+}
+
+Eigen::Quaterniond DetectorInfo::compactScanRotation(
+    const std::pair<size_t, size_t> &index) const {
+  const auto &rotation = (*m_rotations)[index.first];
+  const size_t group =
+      m_rigidScanGroups ? (*m_rigidScanGroups)[index.first] : 0;
+  if (group == 0)
+    return rotation;
+  const size_t i = index.second * m_rigidScanGroupCount + group - 1;
+  return (*m_rigidScanRotations)[i] * rotation;
+}
+
+/// Returns true if merging other can keep the scan in compact form.
+bool DetectorInfo::canMergeCompact(const DetectorInfo &other) const {
+  if ((isScanning() && !m_isCompactScan) ||
+      (other.isScanning() && !other.m_isCompactScan))
+    return false;
+  // Other may have no rigid scan groups (implying identity transforms) or the
+  // same groups as this.
+  if (other.m_rigidScanGroups &&
+      (!m_rigidScanGroups ||
+       m_rigidScanGroupCount != other.m_rigidScanGroupCount ||
+       *m_rigidScanGroups != *other.m_rigidScanGroups))
+    return false;
+  if (m_positions == other.m_positions && m_rotations == other.m_rotations)
+    return true;
+  return std::equal(m_positions->begin(), m_positions->begin() + size(),
+                    other.m_positions->begin()) &&
+         std::equal(m_rotations->begin(), m_rotations->begin() + size(),
+                    other.m_rotations->begin(),
+                    [](const Eigen::Quaterniond &a,
+                       const Eigen::Quaterniond &b) {
+                      return a.coeffs() == b.coeffs();
+                    });
+}
+
+/// Appends the rigid scan transforms of other for given time index.
+void DetectorInfo::appendRigidScanTransforms(const DetectorInfo &other,
+                                             const size_t timeIndex) {
+  if (!m_isCompactScan) {
+    m_isCompactScan = true;
+    m_rigidScanRotations = Kernel::make_cow<std::vector<
+        Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>>();
+    m_rigidScanTranslations =
+        Kernel::make_cow<std::vector<Eigen::Vector3d>>();
+  }
+  auto &rotations = m_rigidScanRotations.access();
+  auto &translations = m_rigidScanTranslations.access();
+  for (size_t group = 0; group < m_rigidScanGroupCount; ++group) {
+    if (other.m_rigidScanGroups) {
+      const size_t i = timeIndex * m_rigidScanGroupCount + group;
+      rotations.push_back((*other.m_rigidScanRotations)[i]);
+      translations.push_back((*other.m_rigidScanTranslations)[i]);
+    } else {
+      rotations.push_back(Eigen::Quaterniond::Identity());
+      translations.push_back(Eigen::Vector3d::Zero());
+    }
+  }
+}
+
+/// Converts a compact scan into positions and rotations for every time index.
+void DetectorInfo::expandCompactScan() {
+  std::vector<Eigen::Vector3d> positions;
+  std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>
+      rotations;
+  positions.reserve(scanSize());
+  rotations.reserve(scanSize());
+  for (size_t timeIndex = 0; timeIndex < scanCount(0); ++timeIndex) {
+    for (size_t detIndex = 0; detIndex < size(); ++detIndex) {
+      positions.push_back(compactScanPosition({detIndex, timeIndex}));
+      rotations.push_back(compactScanRotation({detIndex, timeIndex}));
+    }
+  }
+  m_positions =
+      Kernel::make_cow<std::vector<Eigen::Vector3d>>(std::move(positions));
+  m_rotations = Kernel::make_cow<std::vector<
+      Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>>(
+      std::move(rotations));
+  m_isCompactScan = false;
+  m_rigidScanGroups = Kernel::cow_ptr<std::vector<size_t>>(nullptr);
+  m_rigidScanGroupCount = 0;
+  m_rigidScanRotations = Kernel::cow_ptr<std::vector<
+      Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>>(
+      nullptr);
+  m_rigidScanTranslations =
+      Kernel::cow_ptr<std::vector<Eigen::Vector3d>>(nullptr);
+}
+
 void DetectorInfo::initScanCounts() {
   checkNoTimeDependence();
   if (m_isSyncScan)
@@ -385,10 +602,11 @@ DetectorInfo::buildMergeIndices(const DetectorInfo &other) const {
     const size_t detIndex = getIndex(other.m_indices, linearIndex1).first;
     const auto &interval1 = (*other.m_scanIntervals)[linearIndex1];
     for (size_t timeIndex = 0; timeIndex < scanCount(detIndex); ++timeIndex) {
-      const auto linearIndex2 = linearIndex({detIndex, timeIndex});
-      const auto &interval2 = (*m_scanIntervals)[linearIndex2];
+      const auto &interval2 =
+          (*m_scanIntervals)[linearIndex({detIndex, timeIndex})];
       if (interval1 == interval2) {
-        checkIdenticalIntervals(other, linearIndex1, linearIndex2);
+        checkIdenticalIntervals(other, getIndex(other.m_indices, linearIndex1),
+                                {detIndex, timeIndex});
         merge[linearIndex1] = false;
       } else if ((interval1.first < interval2.second) &&
                  (interval1.second > interval2.first)) {
@@ -410,11 +628,8 @@ DetectorInfo::buildMergeSyncScanIndices(const DetectorInfo &other) const {
       const auto &interval1 = (*other.m_scanIntervals)[t1];
       const auto &interval2 = (*m_scanIntervals)[t2];
       if (interval1 == interval2) {
-        for (size_t detIndex = 0; detIndex < size(); ++detIndex) {
-          const size_t linearIndex1 = other.linearIndex({detIndex, t1});
-          const size_t linearIndex2 = linearIndex({detIndex, t2});
-          checkIdenticalIntervals(other, linearIndex1, linearIndex2);
-        }
+        for (size_t detIndex = 0; detIndex < size(); ++detIndex)
+          checkIdenticalIntervals(other, {detIndex, t1}, {detIndex, t2});
         merge[t1] = false;
       } else if ((interval1.first < interval2.second) &&
                  (interval1.second > interval2.first)) {
@@ -438,15 +653,14 @@ void DetectorInfo::checkSizes(const DetectorInfo &other) const {
   // TODO If we make masking time-independent we need to check masking here.
 }
 
-void DetectorInfo::checkIdenticalIntervals(const DetectorInfo &other,
-                                           const size_t linearIndexOther,
-                                           const size_t linearIndexThis) const {
-  if ((*m_isMasked)[linearIndexThis] != (*other.m_isMasked)[linearIndexOther])
+void DetectorInfo::checkIdenticalIntervals(
+    const DetectorInfo &other, const std::pair<size_t, size_t> &indexOther,
+    const std::pair<size_t, size_t> &indexThis) const {
+  if (isMasked(indexThis) != other.isMasked(indexOther))
     failMerge("matching scan interval but mask flags differ");
-  if ((*m_positions)[linearIndexThis] != (*other.m_positions)[linearIndexOther])
+  if (position(indexThis) != other.position(indexOther))
     failMerge("matching scan interval but positions differ");
-  if ((*m_rotations)[linearIndexThis].coeffs() !=
-      (*other.m_rotations)[linearIndexOther].coeffs())
+  if (rotation(indexThis).coeffs() != other.rotation(indexOther).coeffs())
     failMerge("matching scan interval but rotations differ");
 }
 
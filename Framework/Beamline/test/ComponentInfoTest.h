@@ -507,6 +507,50 @@ public:
     TS_ASSERT(info.rotation(2).isApprox(originalDetRotations.at(2)));
   }
 
+  void test_geometryRevision_shared_by_clone() {
+    auto infos = makeTreeExample();
+    const auto &compInfo = *std::get<0>(infos);
+    TS_ASSERT_DIFFERS(compInfo.geometryRevision(), 0);
+    const auto clones = cloneInfos(infos);
+    TS_ASSERT_EQUALS(std::get<0>(clones)->geometryRevision(),
+                     compInfo.geometryRevision());
+  }
+
+  void test_geometryRevision_reset_by_setPosition() {
+    auto infos = makeTreeExample();
+    auto &compInfo = *std::get<0>(infos);
+    const auto &detInfo = *std::get<1>(infos);
+    const auto detectorRevision = detInfo.geometryRevision();
+    const size_t rootIndex = 4;
+    compInfo.setPosition(rootIndex, {1, 0, 0});
+    TS_ASSERT_EQUALS(compInfo.geometryRevision(), 0);
+    // Moving an assembly also moves the detectors it contains
+    TS_ASSERT_EQUALS(detInfo.geometryRevision(), 0);
+    compInfo.updateGeometryRevision();
+    TS_ASSERT_DIFFERS(compInfo.geometryRevision(), 0);
+    TS_ASSERT_DIFFERS(detectorRevision, 0);
+  }
+
+  void test_geometryRevision_of_components_kept_when_moving_detector() {
+    auto infos = makeTreeExample();
+    auto &compInfo = *std::get<0>(infos);
+    const auto &detInfo = *std::get<1>(infos);
+    const auto revision = compInfo.geometryRevision();
+    compInfo.setPosition(1, {1, 0, 0});
+    TS_ASSERT_EQUALS(compInfo.geometryRevision(), revision);
+    TS_ASSERT_EQUALS(detInfo.geometryRevision(), 0);
+  }
+
+  void test_geometryRevision_reset_by_setRotation() {
+    auto infos = makeTreeExample();
+    auto &compInfo = *std::get<0>(infos);
+    const size_t rootIndex = 4;
+    compInfo.setRotation(rootIndex,
+                         Eigen::Quaterniond(Eigen::AngleAxisd(
+                             M_PI / 2, Eigen::Vector3d{0, 1, 0})));
+    TS_ASSERT_EQUALS(compInfo.geometryRevision(), 0);
+  }
+
   void test_write_positions() {
     const size_t rootIndex = 4;
     do_write_positions(rootIndex);
@@ -171,6 +171,44 @@ public:
     TS_ASSERT_EQUALS(source.size(), 0);
   }
 
+  void test_geometryRevision_unique_for_new_instances() {
+    const DetectorInfo a(PosVec(1), RotVec(1));
+    const DetectorInfo b(PosVec(1), RotVec(1));
+    TS_ASSERT_DIFFERS(a.geometryRevision(), 0);
+    TS_ASSERT_DIFFERS(b.geometryRevision(), 0);
+    TS_ASSERT_DIFFERS(a.geometryRevision(), b.geometryRevision());
+  }
+
+  void test_geometryRevision_shared_by_copy() {
+    const DetectorInfo source(PosVec(7), RotVec(7));
+    const auto copy(source);
+    TS_ASSERT_EQUALS(copy.geometryRevision(), source.geometryRevision());
+  }
+
+  void test_geometryRevision_reset_by_setPosition() {
+    const DetectorInfo source(PosVec(2), RotVec(2));
+    auto copy(source);
+    copy.setPosition(1, {1, 2, 3});
+    TS_ASSERT_EQUALS(copy.geometryRevision(), 0);
+    copy.updateGeometryRevision();
+    TS_ASSERT_DIFFERS(copy.geometryRevision(), 0);
+    TS_ASSERT_DIFFERS(copy.geometryRevision(), source.geometryRevision());
+  }
+
+  void test_geometryRevision_reset_by_setRotation() {
+    DetectorInfo info(PosVec(2), RotVec(2));
+    info.setRotation(1, Eigen::Quaterniond(Eigen::AngleAxisd(
+                            30.0, Eigen::Vector3d{1, 2, 3}.normalized())));
+    TS_ASSERT_EQUALS(info.geometryRevision(), 0);
+  }
+
+  void test_updateGeometryRevision_keeps_valid_revision() {
+    DetectorInfo info(PosVec(2), RotVec(2));
+    const auto revision = info.geometryRevision();
+    info.updateGeometryRevision();
+    TS_ASSERT_EQUALS(info.geometryRevision(), revision);
+  }
+
   void test_no_monitors() {
     DetectorInfo info(PosVec(3), RotVec(3));
     TS_ASSERT(!info.isMonitor(0));
@@ -749,6 +787,164 @@ public:
     TS_ASSERT_THROWS_NOTHING(a2.merge(b));
     TS_ASSERT(a1.isEquivalent(a2));
   }
+
+  void test_merge_sync_identical_geometry_is_compact() {
+    auto a = makeCompactScan(3);
+    TS_ASSERT(a.isScanning());
+    TS_ASSERT(a.isSyncScan());
+    TS_ASSERT(a.isCompactScan());
+    TS_ASSERT_EQUALS(a.size(), 3);
+    TS_ASSERT_EQUALS(a.scanCount(0), 3);
+    TS_ASSERT_EQUALS(a.scanSize(), 9);
+    for (size_t timeIndex = 0; timeIndex < 3; ++timeIndex) {
+      TS_ASSERT_EQUALS(a.position({0, timeIndex}), Eigen::Vector3d(1, 0, 0));
+      TS_ASSERT_EQUALS(a.position({1, timeIndex}), Eigen::Vector3d(0, 1, 0));
+      TS_ASSERT_EQUALS(a.scanInterval({0, timeIndex}),
+                       std::make_pair(static_cast<int64_t>(timeIndex),
+                                      static_cast<int64_t>(timeIndex + 1)));
+    }
+  }
+
+  void test_merge_sync_different_geometry_is_not_compact() {
+    DetectorInfo a(PosVec(1, Eigen::Vector3d(1, 0, 0)),
+                   RotVec(1, Eigen::Quaterniond::Identity()));
+    auto b(a);
+    b.setPosition(0, {2, 0, 0});
+    a.setScanInterval({0, 1});
+    b.setScanInterval({1, 2});
+    a.merge(b);
+    TS_ASSERT(!a.isCompactScan());
+    TS_ASSERT_EQUALS(a.position({0, 0}), Eigen::Vector3d(1, 0, 0));
+    TS_ASSERT_EQUALS(a.position({0, 1}), Eigen::Vector3d(2, 0, 0));
+  }
+
+  void test_rigid_scan_transform() {
+    auto a = makeCompactScan(3);
+    a.updateGeometryRevision();
+    const auto group = a.addRigidScanGroup({0, 1});
+    TS_ASSERT_EQUALS(group, 0);
+    const Eigen::Quaterniond rot(
+        Eigen::AngleAxisd(M_PI / 2.0, Eigen::Vector3d::UnitZ()));
+    const Eigen::Vector3d translation(0, 0, 1);
+    a.setRigidScanTransform(group, 1, rot, translation);
+    TS_ASSERT(a.isCompactScan());
+    TS_ASSERT_EQUALS(a.geometryRevision(), 0);
+    // Time indices without a transform are unchanged
+    TS_ASSERT_EQUALS(a.position({0, 0}), Eigen::Vector3d(1, 0, 0));
+    TS_ASSERT_EQUALS(a.position({0, 2}), Eigen::Vector3d(1, 0, 0));
+    TS_ASSERT(a.position({0, 1}).isApprox(Eigen::Vector3d(0, 1, 1)));
+    TS_ASSERT(a.position({1, 1}).isApprox(Eigen::Vector3d(-1, 0, 1)));
+    TS_ASSERT(a.rotation({0, 1}).isApprox(rot));
+    // Monitor is not part of the group
+    TS_ASSERT_EQUALS(a.position({2, 1}), Eigen::Vector3d(0, 0, -1));
+    TS_ASSERT(a.rotation({2, 1}).isApprox(Eigen::Quaterniond::Identity()));
+  }
+
+  void test_rigid_scan_transforms_are_not_cumulative() {
+    auto a = makeCompactScan(2);
+    const auto group = a.addRigidScanGroup({0});
+    const Eigen::Quaterniond rot(
+        Eigen::AngleAxisd(M_PI / 2.0, Eigen::Vector3d::UnitZ()));
+    a.setRigidScanTransform(group, 1, rot, {0, 0, 0});
+    a.setRigidScanTransform(group, 1, Eigen::Quaterniond::Identity(),
+                            {0, 0, 1});
+    TS_ASSERT(a.position({0, 1}).isApprox(Eigen::Vector3d(1, 0, 1)));
+  }
+
+  void test_multiple_rigid_scan_groups() {
+    auto a = makeCompactScan(2);
+    const auto group0 = a.addRigidScanGroup({0});
+    a.setRigidScanTransform(group0, 1, Eigen::Quaterniond::Identity(),
+                            {0, 0, 1});
+    const auto group1 = a.addRigidScanGroup({1});
+    TS_ASSERT_EQUALS(group1, 1);
+    a.setRigidScanTransform(group1, 1, Eigen::Quaterniond::Identity(),
+                            {0, 0, 2});
+    TS_ASSERT(a.position({0, 1}).isApprox(Eigen::Vector3d(1, 0, 1)));
+    TS_ASSERT(a.position({1, 1}).isApprox(Eigen::Vector3d(0, 1, 2)));
+    TS_ASSERT_EQUALS(a.position({0, 0}), Eigen::Vector3d(1, 0, 0));
+    TS_ASSERT_EQUALS(a.position({1, 0}), Eigen::Vector3d(0, 1, 0));
+  }
+
+  void test_rigid_scan_group_failures() {
+    DetectorInfo a(PosVec(2), RotVec(2));
+    TS_ASSERT_THROWS(a.addRigidScanGroup({0}), const std::runtime_error &);
+    auto b = makeCompactScan(2);
+    const auto group = b.addRigidScanGroup({0});
+    TS_ASSERT_THROWS(b.addRigidScanGroup({1, 0}), const std::runtime_error &);
+    TS_ASSERT_THROWS(b.setRigidScanTransform(group + 1, 0,
+                                             Eigen::Quaterniond::Identity(),
+                                             {0, 0, 0}),
+                     const std::out_of_range &);
+    TS_ASSERT_THROWS(b.setRigidScanTransform(
+                         group, 2, Eigen::Quaterniond::Identity(), {0, 0, 0}),
+                     const std::out_of_range &);
+  }
+
+  void test_compact_scan_setPosition_expands() {
+    auto a = makeCompactScan(3);
+    const auto group = a.addRigidScanGroup({0, 1});
+    a.setRigidScanTransform(group, 2, Eigen::Quaterniond::Identity(),
+                            {0, 0, 1});
+    const auto compact(a);
+    a.setPosition({1, 1}, {5, 5, 5});
+    TS_ASSERT(!a.isCompactScan());
+    TS_ASSERT(a.isSyncScan());
+    TS_ASSERT_EQUALS(a.scanSize(), 9);
+    TS_ASSERT_EQUALS(a.position({1, 1}), Eigen::Vector3d(5, 5, 5));
+    TS_ASSERT(a.position({0, 2}).isApprox(Eigen::Vector3d(1, 0, 1)));
+    TS_ASSERT(a.position({1, 2}).isApprox(Eigen::Vector3d(0, 1, 1)));
+    TS_ASSERT(!a.isEquivalent(compact));
+    a.setPosition({1, 1}, {0, 1, 0});
+    TS_ASSERT(a.isEquivalent(compact));
+    TS_ASSERT(compact.isEquivalent(a));
+  }
+
+  void test_merge_compact_scans() {
+    auto a = makeCompactScan(2);
+    const auto group = a.addRigidScanGroup({0, 1});
+    a.setRigidScanTransform(group, 1, Eigen::Quaterniond::Identity(),
+                            {0, 0, 1});
+    // Unmoved geometry for a third time index keeps the scan compact
+    auto b = makeCompactScan(1);
+    b.setScanInterval({2, 3});
+    a.merge(b);
+    TS_ASSERT(a.isCompactScan());
+    TS_ASSERT_EQUALS(a.scanCount(0), 3);
+    TS_ASSERT(a.position({0, 1}).isApprox(Eigen::Vector3d(1, 0, 1)));
+    TS_ASSERT_EQUALS(a.position({0, 2}), Eigen::Vector3d(1, 0, 0));
+    // Merging identical time indices is a no-op
+    const auto a0(a);
+    a.merge(a0);
+    TS_ASSERT(a.isCompactScan());
+    TS_ASSERT(a.isEquivalent(a0));
+    // Merging a different geometry expands the scan
+    auto c = makeCompactScan(1);
+    c.setPosition(0, {2, 0, 0});
+    c.setScanInterval({3, 4});
+    a.merge(c);
+    TS_ASSERT(!a.isCompactScan());
+    TS_ASSERT_EQUALS(a.scanCount(0), 4);
+    TS_ASSERT(a.position({0, 1}).isApprox(Eigen::Vector3d(1, 0, 1)));
+    TS_ASSERT_EQUALS(a.position({0, 3}), Eigen::Vector3d(2, 0, 0));
+  }
+
+private:
+  /// Returns a synchronous scan over intervals [i, i+1) of 3 detectors (the
+  /// last of which is a monitor) that do not move.
+  DetectorInfo makeCompactScan(const size_t scanCount) {
+    const DetectorInfo base(PosVec{{1, 0, 0}, {0, 1, 0}, {0, 0, -1}},
+                            RotVec(3, Eigen::Quaterniond::Identity()), {2});
+    DetectorInfo a(base);
+    a.setScanInterval({0, 1});
+    for (size_t i = 1; i < scanCount; ++i) {
+      DetectorInfo b(base);
+      b.setScanInterval(
+          {static_cast<int64_t>(i), static_cast<int64_t>(i + 1)});
+      a.merge(b);
+    }
+    return a;
+  }
 };
 
 #endif /* MANTID_BEAMLINE_DETECTORINFOTEST_H_ */
@@ -5,12 +5,14 @@
 #include "MantidKernel/Property.h"
 
 #include <nexus/NeXusFile.hpp>
+#include <vector>
 
 using namespace ::NeXus;
 
 /** This class defines the pulse times for a specific bank.
  * Since some instruments (ARCS, VULCAN) have multiple preprocessors,
  * this means that some banks have different lists of pulse times.
+ * Banks with the same event_time_zero share a single instance, see equals().
  */
 class BankPulseTimes {
 public:
@@ -23,11 +25,8 @@ public:
   /// Constructor with vector of DateAndTime
   BankPulseTimes(const std::vector<Mantid::Types::Core::DateAndTime> &times);
 
-  /// Destructor
-  ~BankPulseTimes();
-
   /// Equals
-  bool equals(size_t otherNumPulse, std::string otherStartTime);
+  bool equals(size_t otherNumPulse, const std::string &otherStartTime) const;
 
   /// String describing the start time
   std::string startTime;
@@ -36,7 +35,7 @@ public:
   size_t numPulses;
 
   /// Array of the pulse times
-  Mantid::Types::Core::DateAndTime *pulseTimes;
+  std::vector<Mantid::Types::Core::DateAndTime> pulseTimes;
 
   /// Vector of period numbers corresponding to each pulse
   std::vector<int> periodNumbers;
@@ -162,6 +162,11 @@ public:
   /// A count of events discarded because they came from a pixel that's not in
   /// the IDF
   size_t discarded_events;
+  /// A count of events discarded because they came from a bad pulse
+  size_t bad_pulse_events;
+
+  /// Whether the events of the pulse at the given time are to be loaded
+  bool isGoodPulse(const Types::Core::DateAndTime &pulseTime) const;
 
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
@@ -201,6 +206,8 @@ private:
   void runLoadMonitors();
   /// Set the filters on TOF.
   void setTimeFilters(const bool monitors);
+  /// Set the filter on the proton charge of each pulse.
+  void setBadPulseFilter(const bool monitors);
 
   /// Load a spectra mapping from the given file
   std::unique_ptr<std::pair<std::vector<int32_t>, std::vector<int32_t>>>
@@ -224,6 +231,11 @@ private:
 
   /// True if the event_id is spectrum no not pixel ID
   bool event_id_is_spec;
+
+  /// Times of the proton charge log entries when filtering bad pulses
+  std::vector<Types::Core::DateAndTime> m_pulseChargeTimes;
+  /// Whether the proton charge at each of m_pulseChargeTimes is acceptable
+  std::vector<bool> m_pulseChargeIsGood;
 };
 
 //-----------------------------------------------------------------------------
@@ -4,6 +4,8 @@
 #include "MantidAPI/DistributedAlgorithm.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <set>
+
 namespace Mantid {
 namespace Kernel {
 class Property;
@@ -75,6 +77,10 @@ private:
   void init() override;
   /// Overwrites Algorithm method
   void exec() override;
+  /// Cross-check the input properties
+  std::map<std::string, std::string> validateInputs() override;
+  /// Check whether a log has been requested by the allow and block lists
+  bool isLogRequested(const std::string &log_name) const;
   /// Load log data from a group
   void loadLogs(::NeXus::File &file, const std::string &entry_name,
                 const std::string &entry_class,
@@ -101,6 +107,11 @@ private:
   /// Use frequency start for Monitor19 and Special1_19 logs with "No Time" for
   /// SNAP
   std::string freqStart;
+
+  /// The names of the only logs to load, if not empty
+  std::set<std::string> m_allowList;
+  /// The names of the logs not to load
+  std::set<std::string> m_blockList;
 };
 
 } // namespace DataHandling
@@ -37,9 +37,9 @@ BankPulseTimes::BankPulseTimes(::NeXus::File &file,
     ;
   }
 
-  pulseTimes = new Mantid::Types::Core::DateAndTime[numPulses];
-  for (size_t i = 0; i < numPulses; i++)
-    pulseTimes[i] = start + seconds[i];
+  pulseTimes.reserve(numPulses);
+  for (const auto second : seconds)
+    pulseTimes.emplace_back(start + second);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -48,22 +48,12 @@ BankPulseTimes::BankPulseTimes(::NeXus::File &file,
  *  @param times
  */
 BankPulseTimes::BankPulseTimes(
-    const std::vector<Mantid::Types::Core::DateAndTime> &times) {
-  numPulses = times.size();
-  pulseTimes = nullptr;
-  if (numPulses == 0)
-    return;
-  pulseTimes = new Mantid::Types::Core::DateAndTime[numPulses];
-  periodNumbers = std::vector<int>(
-      numPulses, FirstPeriod); // TODO we are fixing this at 1 period for all
-  for (size_t i = 0; i < numPulses; i++)
-    pulseTimes[i] = times[i];
+    const std::vector<Mantid::Types::Core::DateAndTime> &times)
+    : numPulses(times.size()), pulseTimes(times),
+      periodNumbers(numPulses, FirstPeriod) {
+  // TODO we are fixing this at 1 period for all
 }
 
-//----------------------------------------------------------------------------------------------
-/** Destructor */
-BankPulseTimes::~BankPulseTimes() { delete[] this->pulseTimes; }
-
 //----------------------------------------------------------------------------------------------
 /** Comparison. Is this bank's pulse times array the same as another one.
  *
@@ -73,7 +63,8 @@ BankPulseTimes::~BankPulseTimes() { delete[] this->pulseTimes; }
  * @return true if the pulse times are the same and so don't need to be
  * reloaded.
  */
-bool BankPulseTimes::equals(size_t otherNumPulse, std::string otherStartTime) {
+bool BankPulseTimes::equals(size_t otherNumPulse,
+                            const std::string &otherStartTime) const {
   return ((this->startTime == otherStartTime) &&
           (this->numPulses == otherNumPulse));
 }
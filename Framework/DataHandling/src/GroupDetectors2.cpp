@@ -1113,17 +1113,17 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
     size_t nonMaskedSpectra(0);
     beh->mutableX(outIndex)[0] = 0.0;
     beh->mutableE(outIndex)[0] = 0.0;
+    std::vector<const EventList *> fromLists;
+    fromLists.reserve(it->second.size());
     for (auto originalWI : it->second) {
-      const EventList &fromEL = inputWS->getSpectrum(originalWI);
-      // Add the event lists with the operator
-      outEL += fromEL;
-
-      // detectors to add to the output spectrum
-      outEL.addDetectorIDs(fromEL.getDetectorIDs());
+      fromLists.push_back(&inputWS->getSpectrum(originalWI));
       if (!isMaskedDetector(spectrumInfo, originalWI)) {
         ++nonMaskedSpectra;
       }
     }
+    // Add all event lists of the group in one go, which also adds their
+    // detectors to the output spectrum and keeps sorted input sorted
+    outEL.addEventLists(fromLists);
     if (nonMaskedSpectra == 0)
       ++nonMaskedSpectra; // Avoid possible divide by zero
     if (!requireDivide)
@@ -52,13 +52,15 @@ void LoadBankFromDiskTask::loadPulseTimes(::NeXus::File &file) {
   std::string thisStartTime;
   size_t thisNumPulses = 0;
   file.getAttr("offset", thisStartTime);
-  if (!file.getInfo().dims.empty())
-    thisNumPulses = file.getInfo().dims[0];
+  const auto dims = file.getInfo().dims;
+  if (!dims.empty())
+    thisNumPulses = dims[0];
   file.closeData();
 
-  // Now, we look through existing ones to see if it is already loaded
-  // thisBankPulseTimes = NULL;
-  for (auto &bankPulseTime : m_loader.m_bankPulseTimes) {
+  // Now, we look through existing ones to see if it is already loaded. Most
+  // files have the same event_time_zero in every bank, so it is read only once
+  // and shared.
+  for (const auto &bankPulseTime : m_loader.m_bankPulseTimes) {
     if (bankPulseTime->equals(thisNumPulses, thisStartTime)) {
       thisBankPulseTimes = bankPulseTime;
       return;
@@ -22,6 +22,7 @@
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
+#include <algorithm>
 #include <boost/function.hpp>
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
@@ -50,9 +51,9 @@ using Types::Core::DateAndTime;
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
-      loadlogs(false), m_logs_loaded_correctly(false), event_id_is_spec(false) {
-}
+      bad_pulse_events(0), compressTolerance(0),
+      m_instrument_loaded_correctly(false), loadlogs(false),
+      m_logs_loaded_correctly(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
 /**
@@ -120,11 +121,19 @@ void LoadEventNexus::init() {
                   "Optional: To only include events before the provided stop "
                   "time, in seconds (relative to the start of the run).");
 
+  auto percentage = boost::make_shared<BoundedValidator<double>>();
+  percentage->setBounds(0., 100.);
+  declareProperty("FilterBadPulsesLowerCutoff", 0., percentage,
+                  "Optional: To exclude events from pulses with a proton "
+                  "charge below this percentage of the mean, as "
+                  "FilterBadPulses does. Keep at 0 to load all pulses.");
+
   std::string grp1 = "Filter Events";
   setPropertyGroup("FilterByTofMin", grp1);
   setPropertyGroup("FilterByTofMax", grp1);
   setPropertyGroup("FilterByTimeStart", grp1);
   setPropertyGroup("FilterByTimeStop", grp1);
+  setPropertyGroup("FilterBadPulsesLowerCutoff", grp1);
 
   declareProperty(
       make_unique<ArrayProperty<string>>("BankName", Direction::Input),
@@ -362,6 +371,10 @@ void LoadEventNexus::exec() {
                            "are not in the Instrument Definition File."
                            "These events were discarded.\n";
   }
+  if (bad_pulse_events > 0) {
+    g_log.notice() << "Skipped " << bad_pulse_events
+                   << " events from pulses with a bad proton charge.\n";
+  }
 
   // If the run was paused at any point, filter out those events (SNS only, I
   // think)
@@ -718,6 +731,9 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
     m_ws->mutableRun().filterByTime(filter_time_start, filter_time_stop);
   }
 
+  // Pulses with a bad proton charge are skipped while reading the events
+  setBadPulseFilter(monitors);
+
   if (metaDataOnly) {
     // Now, create a default X-vector for histogramming, with just 2 bins.
     auto axis = HistogramData::BinEdges{
@@ -1223,6 +1239,81 @@ LoadEventNexus::loadISISVMSSpectraMapping(const std::string &entry_name) {
                                                              std::move(udet));
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * Set up the filtering of events by the proton charge of their pulse. As in
+ * FilterBadPulses, a pulse is bad if its proton charge is below the given
+ * percentage of the mean or above 1.1 times the maximum. The proton_charge log
+ * is reduced to the good pulses and the total charge integrated again.
+ * @param monitors :: If true, the monitor events are being loaded and are not
+ * filtered
+ */
+void LoadEventNexus::setBadPulseFilter(const bool monitors) {
+  m_pulseChargeTimes.clear();
+  m_pulseChargeIsGood.clear();
+  bad_pulse_events = 0;
+  const double lowerCutoff = getProperty("FilterBadPulsesLowerCutoff");
+  if (monitors || lowerCutoff <= 0.)
+    return;
+
+  Run &run = m_ws->mutableRun();
+  const std::string chargeLogName("proton_charge");
+  if (!run.hasProperty(chargeLogName))
+    throw std::runtime_error("Failed to find \"" + chargeLogName +
+                             "\" in sample logs to filter bad pulses.");
+  auto *chargeLog = run.getTimeSeriesProperty<double>(chargeLogName);
+  const auto stats = chargeLog->getStatistics();
+  if (stats.maximum <= 0.)
+    throw std::runtime_error(
+        "Maximum value of charge is not greater than zero (" + chargeLogName +
+        ")");
+  const double minCharge = stats.mean * lowerCutoff * .01;
+  const double maxCharge = stats.maximum * 1.1;
+  g_log.information() << "Filtering pulses with proton charge outside of "
+                      << minCharge << " to " << maxCharge << '\n';
+
+  m_pulseChargeTimes = chargeLog->timesAsVector();
+  const auto charges = chargeLog->valuesAsVector();
+  m_pulseChargeIsGood.reserve(charges.size());
+  std::vector<DateAndTime> goodTimes;
+  std::vector<double> goodCharges;
+  for (size_t i = 0; i < charges.size(); ++i) {
+    const bool isGood = (charges[i] >= minCharge && charges[i] <= maxCharge);
+    m_pulseChargeIsGood.push_back(isGood);
+    if (isGood) {
+      goodTimes.push_back(m_pulseChargeTimes[i]);
+      goodCharges.push_back(charges[i]);
+    }
+  }
+
+  // Only the charge of the loaded pulses counts towards the total
+  auto goodChargeLog =
+      Kernel::make_unique<TimeSeriesProperty<double>>(chargeLogName);
+  goodChargeLog->setUnits(chargeLog->units());
+  goodChargeLog->addValues(goodTimes, goodCharges);
+  run.addProperty(std::move(goodChargeLog), true);
+  run.integrateProtonCharge();
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * Check the proton charge of a pulse against the filter set up by
+ * setBadPulseFilter(). A pulse takes the charge of the last log entry at or
+ * before its time.
+ * @param pulseTime :: The time of the pulse
+ * @return True if the events of the pulse are to be loaded
+ */
+bool LoadEventNexus::isGoodPulse(const DateAndTime &pulseTime) const {
+  if (m_pulseChargeIsGood.empty())
+    return true;
+  auto entry = std::upper_bound(m_pulseChargeTimes.cbegin(),
+                                m_pulseChargeTimes.cend(), pulseTime);
+  if (entry != m_pulseChargeTimes.cbegin())
+    --entry;
+  return m_pulseChargeIsGood[std::distance(m_pulseChargeTimes.cbegin(),
+                                           entry)];
+}
+
 /**
  * Set the filters on TOF.
  * @param monitors :: If true check the monitor properties else use the standard
@@ -1346,6 +1437,8 @@ bool LoadEventNexus::canUseParallelLoader(const bool haveWeights,
   if (filter_time_start != Types::Core::DateAndTime::minimum() ||
       filter_time_stop != Types::Core::DateAndTime::maximum())
     return false;
+  if (!m_pulseChargeIsGood.empty())
+    return false;
   if (!isDefault("CompressTolerance") || !isDefault("SpectrumMin") ||
       !isDefault("SpectrumMax") || !isDefault("SpectrumList") ||
       !isDefault("ChunkNumber"))
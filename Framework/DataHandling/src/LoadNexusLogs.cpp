@@ -146,6 +146,28 @@ void LoadNexusLogs::init() {
   declareProperty(make_unique<PropertyWithValue<std::string>>("NXentryName", "",
                                                               Direction::Input),
                   "Entry in the nexus file from which to read the logs");
+  declareProperty(make_unique<ArrayProperty<std::string>>("AllowList",
+                                                          Direction::Input),
+                  "If specified, only the logs with these names are loaded "
+                  "from the file.");
+  declareProperty(make_unique<ArrayProperty<std::string>>("BlockList",
+                                                          Direction::Input),
+                  "If specified, the logs with these names are not loaded "
+                  "from the file.");
+}
+
+/** Checks that at most one of the allow and block lists is given
+ *  @return A map of property names to error messages
+ */
+std::map<std::string, std::string> LoadNexusLogs::validateInputs() {
+  std::map<std::string, std::string> result;
+  const std::vector<std::string> allow = getProperty("AllowList");
+  const std::vector<std::string> block = getProperty("BlockList");
+  if (!allow.empty() && !block.empty()) {
+    result["AllowList"] = "AllowList and BlockList cannot both be given.";
+    result["BlockList"] = "AllowList and BlockList cannot both be given.";
+  }
+  return result;
 }
 
 /** Executes the algorithm. Reading in the file and creating and populating
@@ -159,6 +181,11 @@ void LoadNexusLogs::exec() {
   std::string filename = getPropertyValue("Filename");
   MatrixWorkspace_sptr workspace = getProperty("Workspace");
 
+  const std::vector<std::string> allowList = getProperty("AllowList");
+  const std::vector<std::string> blockList = getProperty("BlockList");
+  m_allowList = std::set<std::string>(allowList.cbegin(), allowList.cend());
+  m_blockList = std::set<std::string>(blockList.cbegin(), blockList.cend());
+
   std::string entry_name = getPropertyValue("NXentryName");
   // Find the entry name to use (normally "entry" for SNS, "raw_data_1" for
   // ISIS) if entry name is empty
@@ -452,6 +479,8 @@ void LoadNexusLogs::loadLogs(
   std::map<std::string, std::string>::const_iterator iend = entries.end();
   for (std::map<std::string, std::string>::const_iterator itr = entries.begin();
        itr != iend; ++itr) {
+    if (!isLogRequested(itr->first))
+      continue;
     std::string log_class = itr->second;
     if (log_class == "NXlog" || log_class == "NXpositioner") {
       loadNXLog(file, itr->first, log_class, workspace);
@@ -459,11 +488,24 @@ void LoadNexusLogs::loadLogs(
       loadSELog(file, itr->first, workspace);
     }
   }
-  loadVetoPulses(file, workspace);
+  if (isLogRequested("veto_pulse_time"))
+    loadVetoPulses(file, workspace);
 
   file.closeGroup();
 }
 
+/**
+ * Checks whether a log is to be loaded according to the AllowList and
+ * BlockList properties
+ * @param log_name :: The name of the log entry in the file
+ * @returns True if the log should be loaded
+ */
+bool LoadNexusLogs::isLogRequested(const std::string &log_name) const {
+  if (!m_allowList.empty())
+    return m_allowList.count(log_name) > 0;
+  return m_blockList.count(log_name) == 0;
+}
+
 /**
  * Load an NX log entry a group type that has value and time entries.
  * @param file :: A reference to the NeXus file handle opened at the parent
@@ -690,15 +732,14 @@ LoadNexusLogs::createTimeSeries(::NeXus::File &file,
         values.begin(), values.end(),
         [&](const char &c) { return isControlValue(c, prop_name, g_log); },
         ' ');
-    auto tsp = new TimeSeriesProperty<std::string>(prop_name);
-    std::vector<DateAndTime> times;
-    DateAndTime::createVector(start_time, time_double, times);
-    const size_t ntimes = times.size();
+    const size_t ntimes = time_double.size();
+    std::vector<std::string> strings;
+    strings.reserve(ntimes);
     for (size_t i = 0; i < ntimes; ++i) {
-      std::string value_i =
-          std::string(values.data() + i * item_length, item_length);
-      tsp->addValue(times[i], value_i);
+      strings.emplace_back(values.data() + i * item_length, item_length);
     }
+    auto tsp = new TimeSeriesProperty<std::string>(prop_name);
+    tsp->create(start_time, time_double, strings);
     tsp->setUnits(value_units);
     g_log.debug() << "   done reading \"value\" array\n";
     return tsp;
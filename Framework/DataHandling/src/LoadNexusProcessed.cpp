@@ -1423,6 +1423,8 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
                   wsIndex, local_workspace);
       }
     }
+    // X was read for every spectrum, share the copies that are identical
+    local_workspace->shareIdenticalX();
   }
   return local_workspace;
 }
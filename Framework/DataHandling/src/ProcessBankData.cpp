@@ -38,15 +38,53 @@ void ProcessBankData::run() { // override {
   // A count of "bad" TOFs that were too high
   size_t badTofs = 0;
   size_t my_discarded_events(0);
+  // A count of events from pulses with a bad proton charge
+  size_t badPulseEvents = 0;
 
-  prog->report(entry_name + ": precount");
-  // ---- Pre-counting events per pixel ID ----
   auto &outputWS = m_loader.m_ws;
   auto *alg = m_loader.alg;
+
+  // Index into the pulse array
+  int pulse_i = 0;
+
+  // And there are this many pulses
+  int numPulses = static_cast<int>(thisBankPulseTimes->numPulses);
+  if (numPulses > static_cast<int>(event_index->size())) {
+    alg->getLogger().warning()
+        << "Entry " << entry_name
+        << "'s event_index vector is smaller than the event_time_zero field. "
+           "This is inconsistent, so we cannot find pulse times for this "
+           "entry.\n";
+    // This'll make the code skip looking for any pulse times.
+    pulse_i = numPulses + 1;
+  }
+
+  prog->report(entry_name + ": precount");
+  // ---- Pre-counting events per pixel ID ----
   if (m_loader.precount) {
 
     std::vector<size_t> counts(m_max_id - m_min_id + 1, 0);
+    // The events of pulses with a bad proton charge are not stored, so they
+    // are not counted either. The pulses are walked as in the loop below.
+    int countPulse = pulse_i;
+    bool countGoodPulse = true;
+    int countCheckedPulse = -1;
     for (size_t i = 0; i < numEvents; i++) {
+      if (countPulse < numPulses - 1) {
+        while ((i + startAt < event_index->operator[](countPulse)) ||
+               (i + startAt >= event_index->operator[](countPulse + 1))) {
+          countPulse++;
+          if (countPulse >= (numPulses - 1))
+            break;
+        }
+        if (countPulse != countCheckedPulse) {
+          countGoodPulse =
+              alg->isGoodPulse(thisBankPulseTimes->pulseTimes[countPulse]);
+          countCheckedPulse = countPulse;
+        }
+      }
+      if (!countGoodPulse)
+        continue;
       detid_t thisId = detid_t(event_id[i]);
       if (thisId >= m_min_id && thisId <= m_max_id)
         counts[thisId - m_min_id]++;
@@ -82,20 +120,9 @@ void ProcessBankData::run() { // override {
 
   bool pulsetimesincreasing = true;
 
-  // Index into the pulse array
-  int pulse_i = 0;
-
-  // And there are this many pulses
-  int numPulses = static_cast<int>(thisBankPulseTimes->numPulses);
-  if (numPulses > static_cast<int>(event_index->size())) {
-    alg->getLogger().warning()
-        << "Entry " << entry_name
-        << "'s event_index vector is smaller than the event_time_zero field. "
-           "This is inconsistent, so we cannot find pulse times for this "
-           "entry.\n";
-    // This'll make the code skip looking for any pulse times.
-    pulse_i = numPulses + 1;
-  }
+  // Whether the events of the current pulse are kept, checked once per pulse
+  bool goodPulse = true;
+  int checkedPulse = -1;
 
   prog->report(entry_name + ": filling events");
 
@@ -140,11 +167,22 @@ void ProcessBankData::run() { // override {
       else
         lastpulsetime = pulsetime;
 
+      if (pulse_i != checkedPulse) {
+        goodPulse = alg->isGoodPulse(pulsetime);
+        checkedPulse = pulse_i;
+      }
+
       // Flag to break out of the event loop without using goto
       if (breakOut)
         break;
     }
 
+    // Skip the events of pulses with a bad proton charge
+    if (!goodPulse) {
+      ++badPulseEvents;
+      continue;
+    }
+
     // We cached a pointer to the vector<tofEvent> -> so retrieve it and add
     // the event
     detid_t detId = event_id[i];
@@ -234,6 +272,7 @@ void ProcessBankData::run() { // override {
     }
     alg->bad_tofs += badTofs;
     alg->discarded_events += my_discarded_events;
+    alg->bad_pulse_events += badPulseEvents;
   }
 
 #ifndef _WIN32
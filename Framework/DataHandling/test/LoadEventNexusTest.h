@@ -307,6 +307,58 @@ public:
                min >= filterStart);
   }
 
+  void test_bad_pulse_filtered_loading() {
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("OutputWorkspace", "test_all_pulses");
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    TS_ASSERT(ld.execute());
+    auto allWs = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        "test_all_pulses");
+
+    LoadEventNexus ldFiltered;
+    ldFiltered.initialize();
+    ldFiltered.setPropertyValue("OutputWorkspace", "test_good_pulses");
+    ldFiltered.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ldFiltered.setProperty("FilterBadPulsesLowerCutoff", 95.);
+    TS_ASSERT(ldFiltered.execute());
+    auto goodWs = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        "test_good_pulses");
+
+    // The events kept are those whose pulse has an acceptable charge
+    const auto *chargeLog =
+        allWs->run().getTimeSeriesProperty<double>("proton_charge");
+    const auto stats = chargeLog->getStatistics();
+    const double minCharge = stats.mean * 0.95;
+    const double maxCharge = stats.maximum * 1.1;
+    size_t expectedEvents = 0;
+    for (size_t i = 0; i < allWs->getNumberHistograms(); ++i) {
+      for (const auto &pulseTime : allWs->getSpectrum(i).getPulseTimes()) {
+        const double charge = chargeLog->getSingleValue(pulseTime);
+        if (charge >= minCharge && charge <= maxCharge)
+          ++expectedEvents;
+      }
+    }
+    TS_ASSERT_LESS_THAN(expectedEvents, allWs->getNumberEvents());
+    TS_ASSERT_EQUALS(goodWs->getNumberEvents(), expectedEvents);
+    TS_ASSERT_LESS_THAN(goodWs->run().getProtonCharge(),
+                        allWs->run().getProtonCharge());
+
+    AnalysisDataService::Instance().remove("test_all_pulses");
+    AnalysisDataService::Instance().remove("test_good_pulses");
+  }
+
+  void test_bad_pulse_cutoff_must_be_a_percentage() {
+    LoadEventNexus ld;
+    ld.initialize();
+    TS_ASSERT_THROWS(ld.setProperty("FilterBadPulsesLowerCutoff", -1.),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(ld.setProperty("FilterBadPulsesLowerCutoff", 101.),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS_NOTHING(
+        ld.setProperty("FilterBadPulsesLowerCutoff", 100.));
+  }
+
   void test_partial_spectra_loading() {
     std::string wsName = "test_partial_spectra_loading_SpectrumList";
     std::vector<int32_t> specList;
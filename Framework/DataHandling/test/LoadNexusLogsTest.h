@@ -71,6 +71,52 @@ public:
     // Now the stats
   }
 
+  void test_allow_list_loads_only_the_given_logs() {
+    auto testWS = createTestWorkspace();
+    LoadNexusLogs loader;
+    loader.setChild(true);
+    loader.initialize();
+    loader.setProperty("Workspace", testWS);
+    loader.setPropertyValue("Filename", "REF_L_32035.nxs");
+    loader.setPropertyValue("AllowList", "Speed3,Phase1");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    TS_ASSERT(loader.isExecuted());
+
+    const Run &run = testWS->run();
+    TS_ASSERT(run.hasProperty("Speed3"));
+    TS_ASSERT(run.hasProperty("Phase1"));
+    TS_ASSERT(!run.hasProperty("PhaseRequest1"));
+  }
+
+  void test_block_list_skips_the_given_logs() {
+    auto testWS = createTestWorkspace();
+    LoadNexusLogs loader;
+    loader.setChild(true);
+    loader.initialize();
+    loader.setProperty("Workspace", testWS);
+    loader.setPropertyValue("Filename", "REF_L_32035.nxs");
+    loader.setPropertyValue("BlockList", "Speed3");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    TS_ASSERT(loader.isExecuted());
+
+    const Run &run = testWS->run();
+    TS_ASSERT(!run.hasProperty("Speed3"));
+    TS_ASSERT(run.hasProperty("Phase1"));
+    TS_ASSERT_EQUALS(run.getLogData().size(), 74);
+  }
+
+  void test_allow_and_block_lists_cannot_both_be_given() {
+    LoadNexusLogs loader;
+    loader.setChild(true);
+    loader.setRethrows(true);
+    loader.initialize();
+    loader.setProperty("Workspace", createTestWorkspace());
+    loader.setPropertyValue("Filename", "REF_L_32035.nxs");
+    loader.setPropertyValue("AllowList", "Speed3");
+    loader.setPropertyValue("BlockList", "Phase1");
+    TS_ASSERT_THROWS(loader.execute(), std::runtime_error);
+  }
+
   void test_File_With_Runlog_And_Selog() {
     LoadNexusLogs loader;
     loader.initialize();
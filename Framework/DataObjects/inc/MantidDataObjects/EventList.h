@@ -104,6 +104,8 @@ public:
 
   EventList &operator+=(const EventList &more_events);
 
+  void addEventLists(const std::vector<const EventList *> &more_events);
+
   EventList &operator-=(const EventList &more_events);
 
   bool operator==(const EventList &rhs) const;
@@ -12,6 +12,7 @@
 // qualifier applied to function type has no meaning; ignored
 #pragma warning(disable : 4180)
 #endif
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_sort.h"
 #ifdef _MSC_VER
 #pragma warning(default : 4180)
@@ -85,6 +86,27 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * Lay out the output event lists of a split as a vector indexed by target, so
+ * that the output of an event is found without searching the map
+ * @param outputs : The output event lists keyed by target index
+ * @param firstTarget : Set to the target index of the first element
+ * @return The output event lists, with null for targets without one
+ */
+std::vector<EventList *>
+outputsByTarget(const std::map<int, EventList *> &outputs, int &firstTarget) {
+  if (outputs.empty()) {
+    firstTarget = 0;
+    return {};
+  }
+  firstTarget = outputs.begin()->first;
+  std::vector<EventList *> lists(
+      static_cast<size_t>(outputs.rbegin()->first - firstTarget) + 1, nullptr);
+  for (const auto &output : outputs)
+    lists[static_cast<size_t>(output.first - firstTarget)] = output.second;
+  return lists;
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -517,6 +539,130 @@ EventList &EventList::operator+=(const EventList &more_events) {
   return *this;
 }
 
+namespace {
+/** Merge consecutive sorted runs of events into one sorted run.
+ * Neighbouring runs are merged pairwise, with all pairs of a round merged in
+ * parallel, until a single run remains. The merge is stable, so events that
+ * compare equal keep the order of the runs.
+ *
+ * @param events :: The events, made up of the sorted runs.
+ * @param boundaries :: Start index of each run followed by the end index of
+ * the last run.
+ * @param compare :: Comparator the runs are sorted by.
+ * */
+template <class T, class Compare>
+void mergeSortedRuns(std::vector<T> &events, std::vector<size_t> boundaries,
+                     Compare compare) {
+  std::vector<T> buffer(events.size());
+  while (boundaries.size() > 2) {
+    const size_t numRuns = boundaries.size() - 1;
+    tbb::parallel_for(size_t(0), (numRuns + 1) / 2, [&](const size_t pair) {
+      const auto first = events.begin();
+      const auto out = buffer.begin() + boundaries[2 * pair];
+      if (2 * pair + 1 == numRuns)
+        // An odd run out is moved on to the next round unchanged
+        std::copy(first + boundaries[2 * pair],
+                  first + boundaries[2 * pair + 1], out);
+      else
+        std::merge(first + boundaries[2 * pair],
+                   first + boundaries[2 * pair + 1],
+                   first + boundaries[2 * pair + 1],
+                   first + boundaries[2 * pair + 2], out, compare);
+    });
+    std::vector<size_t> merged;
+    for (size_t i = 0; i < numRuns; i += 2)
+      merged.push_back(boundaries[i]);
+    merged.push_back(boundaries.back());
+    boundaries.swap(merged);
+    events.swap(buffer);
+  }
+}
+} // namespace
+
+// --------------------------------------------------------------------------
+/** Append several EventLists to this event list in one go.
+ * Space for all events is reserved up front. If this list and all the lists
+ * to add that contain events are sorted by TOF, or all by pulse time, their
+ * events are merged so that the result is sorted in the same way and no
+ * separate sort is needed. Otherwise the event lists are concatenated as by
+ * operator+=. A union of the sets of detector ID's is done and switching of
+ * event types may occur if the lists are of different types.
+ *
+ * @param more_events :: The EventLists to append.
+ * */
+void EventList::addEventLists(
+    const std::vector<const EventList *> &more_events) {
+  // The most specialised event type and the sort order all lists share
+  EventType newType = eventType;
+  EventSortType newOrder = order;
+  bool haveOrder = !empty();
+  bool sorted = true;
+  size_t numEvents = getNumberEvents();
+  for (const auto *eventList : more_events) {
+    if (static_cast<int>(newType) < static_cast<int>(eventList->eventType))
+      newType = eventList->eventType;
+    numEvents += eventList->getNumberEvents();
+    if (eventList->empty())
+      continue;
+    if (!haveOrder) {
+      newOrder = eventList->order;
+      haveOrder = true;
+    } else if (eventList->order != newOrder) {
+      sorted = false;
+    }
+  }
+  // Pulse times are lost when switching to WeightedEventNoTime
+  if (newOrder == PULSETIME_SORT && newType == WEIGHTED_NOTIME)
+    sorted = false;
+  sorted = sorted && (newOrder == TOF_SORT || newOrder == PULSETIME_SORT);
+
+  switchTo(newType);
+  std::vector<size_t> boundaries{0};
+  switch (eventType) {
+  case TOF:
+    events.reserve(numEvents);
+    break;
+  case WEIGHTED:
+    weightedEvents.reserve(numEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    weightedEventsNoTime.reserve(numEvents);
+    break;
+  }
+  if (!empty())
+    boundaries.push_back(getNumberEvents());
+  for (const auto *eventList : more_events) {
+    *this += *eventList;
+    if (boundaries.back() != getNumberEvents())
+      boundaries.push_back(getNumberEvents());
+  }
+
+  if (!sorted)
+    return;
+  if (boundaries.size() > 2) {
+    switch (eventType) {
+    case TOF:
+      if (newOrder == TOF_SORT)
+        mergeSortedRuns(events, boundaries, std::less<TofEvent>());
+      else
+        mergeSortedRuns(events, boundaries, compareEventPulseTime);
+      break;
+    case WEIGHTED:
+      if (newOrder == TOF_SORT)
+        mergeSortedRuns(weightedEvents, boundaries,
+                        std::less<WeightedEvent>());
+      else
+        mergeSortedRuns(weightedEvents, boundaries, compareEventPulseTime);
+      break;
+    case WEIGHTED_NOTIME:
+      mergeSortedRuns(weightedEventsNoTime, boundaries,
+                      std::less<WeightedEventNoTime>());
+      break;
+    }
+  }
+  this->order = newOrder;
+}
+
 // --------------------------------------------------------------------------
 /** SUBTRACT another EventList from this event list.
  * The event lists are concatenated, but the weights of the incoming
@@ -4165,6 +4311,9 @@ std::string EventList::splitByFullTimeVectorSplitterHelper(
   typename std::vector<T>::iterator eviter;
   std::stringstream msgss;
 
+  int firstTarget;
+  const auto targetOutputs = outputsByTarget(outputs, firstTarget);
+
   // Loop through events
   for (eviter = vecEvents.begin(); eviter != vecEvents.end(); ++eviter) {
     // Obtain time of event
@@ -4192,7 +4341,11 @@ std::string EventList::splitByFullTimeVectorSplitterHelper(
     }
 
     // Copy event to the proper group
-    EventList *myOutput = outputs[group];
+    const auto target = static_cast<size_t>(group - firstTarget);
+    EventList *myOutput =
+        (group >= firstTarget && target < targetOutputs.size())
+            ? targetOutputs[target]
+            : nullptr;
     if (!myOutput) {
       std::stringstream errss;
       errss << "Group " << group << " has a NULL output EventList. "
@@ -4242,10 +4395,35 @@ std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
   auto iter_events = vecEvents.begin();
   auto iter_events_end = vecEvents.end();
 
+  int firstTarget;
+  const auto targetOutputs = outputsByTarget(outputs, firstTarget);
+  auto absoluteTime = [docorrection, toffactor, tofshift](const T &event) {
+    if (docorrection)
+      return event.m_pulsetime.totalNanoseconds() +
+             static_cast<int64_t>(toffactor * event.m_tof * 1000 +
+                                  tofshift * 1.0E9);
+    return event.m_pulsetime.totalNanoseconds() +
+           static_cast<int64_t>(event.m_tof * 1000);
+  };
+
   // std::stringstream debug_ss;
   // debug_ss << "\nFilter events...:\n";
 
   for (size_t i = 0; i < num_splitters; ++i) {
+    if (iter_events == iter_events_end)
+      break;
+    // Skip straight to the splitter containing the next event: the splitters
+    // in between would receive no events
+    const int64_t next_time = absoluteTime(*iter_events);
+    if (next_time >= vectimes[i + 1]) {
+      i = static_cast<size_t>(std::upper_bound(vectimes.begin() + i + 1,
+                                               vectimes.end(), next_time) -
+                              vectimes.begin()) -
+          1;
+      if (i >= num_splitters)
+        break;
+    }
+
     // get one splitter
     int64_t start_i64 = vectimes[i];
     int64_t stop_i64 = vectimes[i + 1];
@@ -4255,15 +4433,7 @@ std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
 
     // go over events
     while (iter_events != iter_events_end) {
-      int64_t absolute_time;
-      if (docorrection)
-        absolute_time =
-            iter_events->m_pulsetime.totalNanoseconds() +
-            static_cast<int64_t>(toffactor * iter_events->m_tof * 1000 +
-                                 tofshift * 1.0E9);
-      else
-        absolute_time = iter_events->m_pulsetime.totalNanoseconds() +
-                        static_cast<int64_t>(iter_events->m_tof * 1000);
+      const int64_t absolute_time = absoluteTime(*iter_events);
 
       // debug_ss << "  event " << iter_events - vecEvents.begin() << " abs.time
       // = " << absolute_time << "\n";
@@ -4279,7 +4449,11 @@ std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
         // in the splitter, then copy the event into another
         const T eventCopy(*iter_events);
         // Copy event to the proper group
-        EventList *myOutput = outputs[group];
+        const auto target = static_cast<size_t>(group - firstTarget);
+        EventList *myOutput =
+            (group >= firstTarget && target < targetOutputs.size())
+                ? targetOutputs[target]
+                : nullptr;
         if (!myOutput) {
           // there is no such group defined. quit for this group
           std::stringstream errss;
@@ -6,6 +6,7 @@
 #include "MantidGeometry/Math/Quadrilateral.h"
 #include "MantidKernel/V2D.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -112,16 +113,18 @@ void calcRectangleIntersections(
     const Quadrilateral &inputQ, const size_t y_start, const size_t y_end,
     const size_t x_start, const size_t x_end,
     std::vector<std::tuple<size_t, size_t, double>> &areaInfo) {
+  // Clamp to both the input rectangle and the output bin so that parts of
+  // the input lying outside the output grid do not count
   std::vector<double> width;
   width.reserve(x_end - x_start);
   for (size_t xi = x_start; xi < x_end; ++xi) {
-    const double x0 = (xi == x_start) ? inputQ.minX() : xAxis[xi];
-    const double x1 = (xi == x_end - 1) ? inputQ.maxX() : xAxis[xi + 1];
+    const double x0 = std::max(xAxis[xi], inputQ.minX());
+    const double x1 = std::min(xAxis[xi + 1], inputQ.maxX());
     width.push_back(x1 - x0);
   }
   for (size_t yi = y_start; yi < y_end; ++yi) {
-    const double y0 = (yi == y_start) ? inputQ.minY() : yAxis[yi];
-    const double y1 = (yi == y_end - 1) ? inputQ.maxY() : yAxis[yi + 1];
+    const double y0 = std::max(yAxis[yi], inputQ.minY());
+    const double y1 = std::min(yAxis[yi + 1], inputQ.maxY());
     const double height = y1 - y0;
     auto width_it = width.begin();
     for (size_t xi = x_start; xi < x_end; ++xi) {
@@ -525,44 +528,69 @@ void rebinToOutput(const Quadrilateral &inputQ,
                              x_end))
     return;
 
-  const auto &inY = inputWS->y(i);
-  const auto &inE = inputWS->e(i);
-  // It seems to be more efficient to construct this once and clear it before
-  // each calculation in the loop
-  ConvexPolygon intersectOverlap;
-  for (size_t y = qstart; y < qend; ++y) {
-    const double vlo = verticalAxis[y];
-    const double vhi = verticalAxis[y + 1];
-    for (size_t xi = x_start; xi < x_end; ++xi) {
-      const V2D ll(X[xi], vlo);
-      const V2D lr(X[xi + 1], vlo);
-      const V2D ur(X[xi + 1], vhi);
-      const V2D ul(X[xi], vhi);
-      const Quadrilateral outputQ(ll, lr, ur, ul);
+  const double signal = inputWS->y(i)[j];
+  if (std::isnan(signal))
+    return;
+  const double error = inputWS->e(i)[j];
+  const bool isDistribution = inputWS->isDistribution();
 
-      double yValue = inY[j];
-      if (std::isnan(yValue)) {
-        continue;
-      }
-      intersectOverlap.clear();
-      if (intersection(outputQ, inputQ, intersectOverlap)) {
-        const double weight = intersectOverlap.area() / inputQ.area();
-        yValue *= weight;
-        double eValue = inE[j];
-        if (inputWS->isDistribution()) {
-          const double overlapWidth =
-              intersectOverlap.maxX() - intersectOverlap.minX();
-          yValue *= overlapWidth;
-          eValue *= overlapWidth;
-        }
-        eValue = eValue * eValue * weight;
-        PARALLEL_CRITICAL(overlap_sum) {
-          outputWS.mutableY(y)[xi] += yValue;
-          outputWS.mutableE(y)[xi] += eValue;
+  // Rectangles, as used by Rebin2D, have a closed-form overlap with each
+  // output bin, as do y-axis trapezoids unless the width of each overlap is
+  // needed to undo the division by the bin width of a distribution.
+  std::vector<std::tuple<size_t, size_t, double>> areaInfo;
+  std::vector<double> overlapWidths;
+  const QuadrilateralType inputQType = getQuadrilateralType(inputQ);
+  if (inputQType == QuadrilateralType::Rectangle) {
+    calcRectangleIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
+                               x_end, areaInfo);
+    for (const auto &ai : areaInfo) {
+      const size_t xi = std::get<0>(ai);
+      overlapWidths.push_back(std::min(X[xi + 1], inputQ.maxX()) -
+                              std::max(X[xi], inputQ.minX()));
+    }
+  } else if (inputQType == QuadrilateralType::TrapezoidY && !isDistribution) {
+    calcTrapezoidYIntersections(X, verticalAxis, inputQ, qstart, qend, x_start,
+                                x_end, areaInfo);
+  } else {
+    // It seems to be more efficient to construct this once and clear it
+    // before each calculation in the loop
+    ConvexPolygon intersectOverlap;
+    for (size_t y = qstart; y < qend; ++y) {
+      const double vlo = verticalAxis[y];
+      const double vhi = verticalAxis[y + 1];
+      for (size_t xi = x_start; xi < x_end; ++xi) {
+        const V2D ll(X[xi], vlo);
+        const V2D lr(X[xi + 1], vlo);
+        const V2D ur(X[xi + 1], vhi);
+        const V2D ul(X[xi], vhi);
+        const Quadrilateral outputQ(ll, lr, ur, ul);
+        intersectOverlap.clear();
+        if (intersection(outputQ, inputQ, intersectOverlap)) {
+          areaInfo.emplace_back(xi, y, intersectOverlap.area());
+          overlapWidths.push_back(intersectOverlap.maxX() -
+                                  intersectOverlap.minX());
         }
       }
     }
   }
+
+  // Accumulate all overlaps of this input bin under a single lock
+  const double inputQArea = inputQ.area();
+  PARALLEL_CRITICAL(overlap_sum) {
+    for (size_t k = 0; k < areaInfo.size(); ++k) {
+      const size_t xi = std::get<0>(areaInfo[k]);
+      const size_t yi = std::get<1>(areaInfo[k]);
+      const double weight = std::get<2>(areaInfo[k]) / inputQArea;
+      double yValue = signal * weight;
+      double eValue = error;
+      if (isDistribution) {
+        yValue *= overlapWidths[k];
+        eValue *= overlapWidths[k];
+      }
+      outputWS.mutableY(yi)[xi] += yValue;
+      outputWS.mutableE(yi)[xi] += eValue * eValue * weight;
+    }
+  }
 }
 
 /**
@@ -646,12 +674,13 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
     }
   }
 
+  // Accumulate all overlaps of this input bin under a single lock
   const double variance = error * error;
-  for (const auto &ai : areaInfo) {
-    const size_t xi = std::get<0>(ai);
-    const size_t yi = std::get<1>(ai);
-    const double weight = std::get<2>(ai) / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
+  PARALLEL_CRITICAL(overlap) {
+    for (const auto &ai : areaInfo) {
+      const size_t xi = std::get<0>(ai);
+      const size_t yi = std::get<1>(ai);
+      const double weight = std::get<2>(ai) / inputQArea;
       outputWS.mutableY(yi)[xi] += signal * weight;
       outputWS.mutableE(yi)[xi] += variance * weight;
       outputWS.dataF(yi)[xi] += weight * inputWeight;
@@ -254,6 +254,23 @@ void ScanningWorkspaceBuilder::buildPositions(
 
 void ScanningWorkspaceBuilder::buildRelativeRotationsForScans(
     Geometry::DetectorInfo &outputDetectorInfo) const {
+  if (outputDetectorInfo.isCompactScan()) {
+    // All non-monitor detectors move as a rigid body, store only a single
+    // transform per time index instead of positions for every time index.
+    std::vector<size_t> detectorIndices;
+    for (size_t i = 0; i < outputDetectorInfo.size(); ++i)
+      if (!outputDetectorInfo.isMonitor(i))
+        detectorIndices.push_back(i);
+    const auto group = outputDetectorInfo.addRigidScanGroup(detectorIndices);
+    for (size_t j = 0; j < m_nTimeIndexes; ++j) {
+      const auto rotation = Kernel::Quat(m_instrumentAngles[j], m_rotationAxis);
+      auto rotatedCentre = m_rotationPosition;
+      rotation.rotate(rotatedCentre);
+      outputDetectorInfo.setRigidScanTransform(
+          group, j, rotation, m_rotationPosition - rotatedCentre);
+    }
+    return;
+  }
   for (size_t i = 0; i < outputDetectorInfo.size(); ++i) {
     for (size_t j = 0; j < outputDetectorInfo.scanCount(i); ++j) {
       if (outputDetectorInfo.isMonitor({i, j}))
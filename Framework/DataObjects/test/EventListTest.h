@@ -279,6 +279,72 @@ public:
     TS_ASSERT(!el2.hasDetectorID(0));
   }
 
+  void test_addEventLists_merges_sorted_lists() {
+    std::vector<EventList> lists(5);
+    std::vector<const EventList *> listPointers;
+    for (size_t i = 0; i < lists.size(); ++i) {
+      for (int j = 0; j < 10; ++j)
+        lists[i] += TofEvent(static_cast<double>((j * 7 + i * 3) % 50),
+                             static_cast<int64_t>(j));
+      lists[i].addDetectorID(static_cast<detid_t>(i));
+      lists[i].sortTof();
+      listPointers.push_back(&lists[i]);
+    }
+    // An empty list does not prevent merging
+    EventList empty;
+    listPointers.push_back(&empty);
+    // Weights switch the result to weighted events
+    lists[2].switchTo(WEIGHTED);
+
+    EventList sum;
+    sum.addEventLists(listPointers);
+    TS_ASSERT_EQUALS(sum.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(sum.getSortType(), TOF_SORT);
+    TS_ASSERT_EQUALS(sum.getNumberEvents(), 50);
+    TS_ASSERT_EQUALS(sum.getDetectorIDs().size(), 5);
+    const auto &events = sum.getWeightedEvents();
+    for (size_t i = 1; i < events.size(); ++i)
+      TS_ASSERT_LESS_THAN_EQUALS(events[i - 1].tof(), events[i].tof());
+
+    // The result holds the same events as concatenating the lists
+    EventList expected;
+    for (const auto &eventList : lists)
+      expected += eventList;
+    expected.sortPulseTimeTOF();
+    EventList merged(sum);
+    merged.sortPulseTimeTOF();
+    TS_ASSERT_EQUALS(merged, expected);
+  }
+
+  void test_addEventLists_concatenates_unsorted_lists() {
+    EventList pulseSorted;
+    pulseSorted += TofEvent(5.0, 1);
+    pulseSorted += TofEvent(1.0, 2);
+    pulseSorted.sortPulseTime();
+    EventList tofSorted;
+    tofSorted += TofEvent(3.0, 0);
+    tofSorted.sortTof();
+
+    EventList sum;
+    sum.addEventLists({&pulseSorted, &tofSorted});
+    TS_ASSERT_EQUALS(sum.getSortType(), UNSORTED);
+    const auto &events = sum.getEvents();
+    TS_ASSERT_EQUALS(events.size(), 3);
+    TS_ASSERT_EQUALS(events[0].tof(), 5.0);
+    TS_ASSERT_EQUALS(events[1].tof(), 1.0);
+    TS_ASSERT_EQUALS(events[2].tof(), 3.0);
+
+    // Lists sorted by pulse time are merged by pulse time
+    EventList pulseSum;
+    pulseSorted.sortPulseTime();
+    tofSorted.sortPulseTime();
+    pulseSum.addEventLists({&pulseSorted, &tofSorted});
+    TS_ASSERT_EQUALS(pulseSum.getSortType(), PULSETIME_SORT);
+    TS_ASSERT_EQUALS(pulseSum.getEvents()[0].tof(), 3.0);
+    TS_ASSERT_EQUALS(pulseSum.getEvents()[1].tof(), 5.0);
+    TS_ASSERT_EQUALS(pulseSum.getEvents()[2].tof(), 1.0);
+  }
+
   //==================================================================================
   //--- Switching to Weighted Events ----
   //==================================================================================
@@ -1880,6 +1946,35 @@ public:
     return;
   }
 
+  void test_splitByFullTimeVectorSplitter_skips_empty_splitters() {
+    // Two bursts of events separated by many splitters without events
+    EventList events;
+    for (int64_t i = 0; i < 10; ++i)
+      events.addEventQuickly(TofEvent(0.0, DateAndTime(1000 + i)));
+    for (int64_t i = 0; i < 20; ++i)
+      events.addEventQuickly(TofEvent(0.0, DateAndTime(900000 + i)));
+
+    std::map<int, EventList *> outputs;
+    for (int i = -1; i < 11; i++)
+      outputs.emplace(i, new EventList());
+
+    // Fewer splitters than events, so that they are walked in turn
+    std::vector<int64_t> vec_splitTimes{0,    500,    1005,   2000,
+                                        3000, 4000,   5000,   6000,
+                                        7000, 800000, 950000, 2000000};
+    std::vector<int> vec_splitGroup{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    events.splitByFullTimeMatrixSplitter(vec_splitTimes, vec_splitGroup,
+                                         outputs, false, 1.0, 0.0);
+
+    const std::vector<size_t> expected{0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 20, 0};
+    for (int i = -1; i < 11; i++)
+      TS_ASSERT_EQUALS(outputs[i]->getNumberEvents(), expected[i + 1]);
+
+    for (auto &output : outputs) {
+      delete output.second;
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_splitByTime_allTypes() {
     // Go through each possible EventType as the input
@@ -256,6 +256,8 @@ public:
     TS_ASSERT_THROWS_NOTHING(ws = builder.buildWorkspace())
 
     const auto &detInfo = ws->detectorInfo();
+    // Rigid rotation of all detectors is stored compactly
+    TS_ASSERT(detInfo.isCompactScan())
 
     for (size_t i = 0; i < nDetectors; ++i) {
       TS_ASSERT_DELTA(0.0, detInfo.position({i, 0}).X(), 1e-12)
@@ -316,6 +318,8 @@ public:
     TS_ASSERT_THROWS_NOTHING(ws = builder.buildWorkspace())
 
     const auto &detInfo = ws->detectorInfo();
+    // Rigid rotation of all detectors is stored compactly
+    TS_ASSERT(detInfo.isCompactScan())
 
     for (size_t i = 0; i < nDetectors; ++i) {
       TS_ASSERT_DELTA(0.0, detInfo.position({i, 0}).X(), 1e-12)
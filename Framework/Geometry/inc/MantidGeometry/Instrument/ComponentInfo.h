@@ -152,6 +152,8 @@ public:
   void setScanInterval(const std::pair<int64_t, int64_t> &interval);
   void merge(const ComponentInfo &other);
   size_t scanSize() const;
+  uint64_t geometryRevision() const;
+  void updateGeometryRevision();
   friend class Instrument;
 };
 
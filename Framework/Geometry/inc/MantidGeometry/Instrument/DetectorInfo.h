@@ -129,6 +129,14 @@ public:
                                        Types::Core::DateAndTime> &interval);
 
   void merge(const DetectorInfo &other);
+  size_t addRigidScanGroup(const std::vector<size_t> &detectorIndices);
+  void setRigidScanTransform(const size_t group, const size_t timeIndex,
+                             const Kernel::Quat &rotation,
+                             const Kernel::V3D &translation);
+  bool isCompactScan() const;
+
+  uint64_t geometryRevision() const;
+  void updateGeometryRevision();
 
   friend class API::SpectrumInfo;
   friend class Instrument;
@@ -9,6 +9,7 @@
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/Material.h"
+#include <array>
 #include <map>
 #include <memory>
 
@@ -152,7 +153,24 @@ public:
   void updateGeometryHandler();
 
 private:
+  /// Node of the bounding volume hierarchy built over the triangles.
+  /// Interior nodes have a zero count and store the index of their first
+  /// child in offset, the second child immediately follows it. Leaves store
+  /// the position of their first triangle in m_bvhTriangles.
+  struct BVHNode {
+    std::array<double, 3> minPoint;
+    std::array<double, 3> maxPoint;
+    uint32_t offset;
+    uint32_t count;
+  };
+
   void initialize();
+  /// Build the bounding volume hierarchy used to accelerate ray queries
+  void buildBVH();
+  /// Determine if a ray passes through the box of a BVH node
+  bool rayIntersectsNode(const BVHNode &node,
+                         const std::array<double, 3> &start,
+                         const std::array<double, 3> &direction) const;
   /// Get intersections
   void getIntersections(const Kernel::V3D &start, const Kernel::V3D &direction,
                         std::vector<Kernel::V3D> &intersectionPoints,
@@ -193,6 +211,10 @@ private:
   /// Triangles are specified by indices into a list of vertices.
   std::vector<uint16_t> m_triangles;
   std::vector<Kernel::V3D> m_vertices;
+  /// Flattened bounding volume hierarchy over the triangles
+  std::vector<BVHNode> m_bvhNodes;
+  /// Triangle indices ordered so that each BVH leaf is a contiguous range
+  std::vector<uint32_t> m_bvhTriangles;
   /// material composition
   Kernel::Material m_material;
 };
@@ -18,6 +18,7 @@
 #include <boost/make_shared.hpp>
 #include <nexus/NeXusFile.hpp>
 #include <queue>
+#include <tbb/parallel_sort.h>
 
 using namespace Mantid::Kernel;
 using Mantid::Kernel::Exception::InstrumentDefinitionError;
@@ -741,8 +742,9 @@ void Instrument::markAsDetectorIncomplete(const IDetector *det) {
 /// markAsDetectorIncomplete.
 void Instrument::markAsDetectorFinalize() {
   // Detectors (even when different objects) are NOT allowed to have duplicate
-  // ids. This method establishes the presence of duplicates.
-  std::sort(
+  // ids. This method establishes the presence of duplicates. Sorting is done in
+  // parallel since instruments may have millions of detectors.
+  tbb::parallel_sort(
       m_detectorCache.begin(), m_detectorCache.end(),
       [](const std::tuple<detid_t, IDetector_const_sptr, bool> &a,
          const std::tuple<detid_t, IDetector_const_sptr, bool> &b) -> bool {
@@ -428,6 +428,18 @@ void ComponentInfo::merge(const ComponentInfo &other) {
   m_componentInfo->merge(*other.m_componentInfo);
 }
 
+/** Returns a number identifying the current positions and rotations of all
+ * non-detector components, or 0 if they were modified since
+ * updateGeometryRevision() was last called. */
+uint64_t ComponentInfo::geometryRevision() const {
+  return m_componentInfo->geometryRevision();
+}
+
+/// Assigns a new revision if the component geometry was modified.
+void ComponentInfo::updateGeometryRevision() {
+  m_componentInfo->updateGeometryRevision();
+}
+
 size_t ComponentInfo::scanSize() const { return m_componentInfo->scanSize(); }
 
 } // namespace Geometry
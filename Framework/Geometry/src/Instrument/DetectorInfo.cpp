@@ -371,6 +371,42 @@ void DetectorInfo::merge(const DetectorInfo &other) {
   m_detectorInfo->merge(*other.m_detectorInfo);
 }
 
+/** Adds a group of detectors that move together in a synchronous scan and
+ * returns the index of the group. See
+ * Beamline::DetectorInfo::addRigidScanGroup(). */
+size_t
+DetectorInfo::addRigidScanGroup(const std::vector<size_t> &detectorIndices) {
+  return m_detectorInfo->addRigidScanGroup(detectorIndices);
+}
+
+/** Set the rigid-body transform (rotation followed by translation) of a rigid
+ * scan group for given time index. Not thread safe. */
+void DetectorInfo::setRigidScanTransform(const size_t group,
+                                         const size_t timeIndex,
+                                         const Kernel::Quat &rotation,
+                                         const Kernel::V3D &translation) {
+  m_detectorInfo->setRigidScanTransform(group, timeIndex,
+                                        Kernel::toQuaterniond(rotation),
+                                        Kernel::toVector3d(translation));
+}
+
+/// Returns true if scan positions are stored as rigid scan group transforms.
+bool DetectorInfo::isCompactScan() const {
+  return m_detectorInfo->isCompactScan();
+}
+
+/** Returns a number identifying the current detector positions and rotations,
+ * or 0 if they were modified since updateGeometryRevision() was last called.
+ * See Beamline::DetectorInfo::geometryRevision(). */
+uint64_t DetectorInfo::geometryRevision() const {
+  return m_detectorInfo->geometryRevision();
+}
+
+/// Assigns a new revision if the detector geometry was modified.
+void DetectorInfo::updateGeometryRevision() {
+  m_detectorInfo->updateGeometryRevision();
+}
+
 const Geometry::IDetector &DetectorInfo::getDetector(const size_t index) const {
   size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
   if (m_lastIndex[thread] != index) {
@@ -460,6 +460,9 @@ void InstrumentDefinitionParser::
     }
     pNode = it.nextNode();
   }
+  // Sorted for fast lookup in setLogfile(), which is called for every
+  // component.
+  std::sort(m_hasParameterElement.begin(), m_hasParameterElement.end());
 
   m_hasParameterElement_beenSet = true;
 }
@@ -2061,9 +2064,8 @@ void InstrumentDefinitionParser::setLogfile(
   // parameter, see
   // defintion of m_hasParameterElement for more info
   if (m_hasParameterElement_beenSet)
-    if (m_hasParameterElement.end() == std::find(m_hasParameterElement.begin(),
-                                                 m_hasParameterElement.end(),
-                                                 pElem))
+    if (!std::binary_search(m_hasParameterElement.begin(),
+                            m_hasParameterElement.end(), pElem))
       return;
 
   Poco::AutoPtr<NodeList> pNL_comp =
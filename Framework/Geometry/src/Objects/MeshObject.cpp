@@ -10,12 +10,20 @@
 
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+#include <limits>
+
 namespace Mantid {
 namespace Geometry {
 
 using Kernel::Material;
 using Kernel::V3D;
 
+namespace {
+/// Maximum number of triangles stored in a leaf of the BVH
+constexpr uint32_t BVH_LEAF_SIZE = 4;
+} // namespace
+
 MeshObject::MeshObject(const std::vector<uint16_t> &faces,
                        const std::vector<V3D> &vertices,
                        const Kernel::Material &material)
@@ -43,6 +51,133 @@ void MeshObject::initialize() {
         "). MeshObject cannot have more than 65535 vertices.");
   }
   m_handler = boost::make_shared<GeometryHandler>(*this);
+  buildBVH();
+}
+
+/**
+ * Build a bounding volume hierarchy over the triangles so that ray queries
+ * only need to test the triangles in the boxes that the ray passes through.
+ * Each node is split at the median triangle centroid along the longest axis
+ * of its centroid bounds.
+ */
+void MeshObject::buildBVH() {
+  m_bvhNodes.clear();
+  m_bvhTriangles.clear();
+  const auto nTriangles = static_cast<uint32_t>(numberOfTriangles());
+  if (nTriangles == 0)
+    return;
+
+  std::vector<V3D> centroids(nTriangles);
+  m_bvhTriangles.resize(nTriangles);
+  V3D vertex1, vertex2, vertex3;
+  for (uint32_t i = 0; i < nTriangles; ++i) {
+    getTriangle(i, vertex1, vertex2, vertex3);
+    centroids[i] = (vertex1 + vertex2 + vertex3) / 3.0;
+    m_bvhTriangles[i] = i;
+  }
+
+  // Nodes still to be processed with the range of triangles they cover
+  struct PendingNode {
+    uint32_t node;
+    uint32_t first;
+    uint32_t last;
+  };
+  m_bvhNodes.reserve(2 * (nTriangles / BVH_LEAF_SIZE + 1));
+  m_bvhNodes.emplace_back();
+  std::vector<PendingNode> pending{{0, 0, nTriangles}};
+  while (!pending.empty()) {
+    const auto current = pending.back();
+    pending.pop_back();
+
+    // Bounds of the triangles are padded so that flat or axis-aligned
+    // triangles still have a box of non-zero thickness
+    std::array<double, 3> minPoint, maxPoint, minCentre, maxCentre;
+    minPoint.fill(std::numeric_limits<double>::max());
+    minCentre.fill(std::numeric_limits<double>::max());
+    maxPoint.fill(std::numeric_limits<double>::lowest());
+    maxCentre.fill(std::numeric_limits<double>::lowest());
+    for (uint32_t i = current.first; i < current.last; ++i) {
+      const auto triangle = m_bvhTriangles[i];
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const auto &vertex = m_vertices[m_triangles[3 * triangle + corner]];
+        const std::array<double, 3> coords{
+            {vertex.X(), vertex.Y(), vertex.Z()}};
+        for (size_t k = 0; k < 3; ++k) {
+          minPoint[k] = std::min(minPoint[k], coords[k] - M_TOLERANCE);
+          maxPoint[k] = std::max(maxPoint[k], coords[k] + M_TOLERANCE);
+        }
+      }
+      const auto &centre = centroids[triangle];
+      const std::array<double, 3> coords{{centre.X(), centre.Y(), centre.Z()}};
+      for (size_t k = 0; k < 3; ++k) {
+        minCentre[k] = std::min(minCentre[k], coords[k]);
+        maxCentre[k] = std::max(maxCentre[k], coords[k]);
+      }
+    }
+
+    auto &node = m_bvhNodes[current.node];
+    node.minPoint = minPoint;
+    node.maxPoint = maxPoint;
+    const uint32_t count = current.last - current.first;
+    if (count <= BVH_LEAF_SIZE) {
+      node.offset = current.first;
+      node.count = count;
+      continue;
+    }
+
+    size_t axis = 0;
+    for (size_t k = 1; k < 3; ++k) {
+      if (maxCentre[k] - minCentre[k] > maxCentre[axis] - minCentre[axis])
+        axis = k;
+    }
+    const uint32_t middle = current.first + count / 2;
+    std::nth_element(m_bvhTriangles.begin() + current.first,
+                     m_bvhTriangles.begin() + middle,
+                     m_bvhTriangles.begin() + current.last,
+                     [&centroids, axis](uint32_t lhs, uint32_t rhs) {
+                       return centroids[lhs][axis] < centroids[rhs][axis];
+                     });
+
+    const auto firstChild = static_cast<uint32_t>(m_bvhNodes.size());
+    node.offset = firstChild;
+    node.count = 0;
+    // node is invalidated by the following insertions
+    m_bvhNodes.emplace_back();
+    m_bvhNodes.emplace_back();
+    pending.push_back({firstChild, current.first, middle});
+    pending.push_back({firstChild + 1, middle, current.last});
+  }
+}
+
+/**
+ * Determine if a ray passes through the bounding box of a BVH node using the
+ * slab method.
+ * @param node :: The node to test
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @returns true if the ray passes through the box in front of its start
+ */
+bool MeshObject::rayIntersectsNode(
+    const BVHNode &node, const std::array<double, 3> &start,
+    const std::array<double, 3> &direction) const {
+  double tMin = std::numeric_limits<double>::lowest();
+  double tMax = std::numeric_limits<double>::max();
+  for (size_t k = 0; k < 3; ++k) {
+    if (direction[k] == 0.0) {
+      if (start[k] < node.minPoint[k] || start[k] > node.maxPoint[k])
+        return false;
+      continue;
+    }
+    double t1 = (node.minPoint[k] - start[k]) / direction[k];
+    double t2 = (node.maxPoint[k] - start[k]) / direction[k];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tMin = std::max(tMin, t1);
+    tMax = std::min(tMax, t2);
+    if (tMin > tMax)
+      return false;
+  }
+  return tMax >= -M_TOLERANCE;
 }
 
 /**
@@ -179,13 +314,33 @@ void MeshObject::getIntersections(const Kernel::V3D &start,
                                   std::vector<Kernel::V3D> &intersectionPoints,
                                   std::vector<int> &entryExitFlags) const {
 
+  if (m_bvhNodes.empty())
+    return;
+
+  const std::array<double, 3> rayStart{{start.X(), start.Y(), start.Z()}};
+  const std::array<double, 3> rayDirection{
+      {direction.X(), direction.Y(), direction.Z()}};
   V3D vertex1, vertex2, vertex3, intersection;
   int entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
-    if (rayIntersectsTriangle(start, direction, vertex1, vertex2, vertex3,
-                              intersection, entryExit)) {
-      intersectionPoints.push_back(intersection);
-      entryExitFlags.push_back(entryExit);
+  // Only the triangles in the BVH leaves crossed by the ray are tested
+  std::vector<uint32_t> nodesToVisit{0};
+  while (!nodesToVisit.empty()) {
+    const auto &node = m_bvhNodes[nodesToVisit.back()];
+    nodesToVisit.pop_back();
+    if (!rayIntersectsNode(node, rayStart, rayDirection))
+      continue;
+    if (node.count == 0) {
+      nodesToVisit.push_back(node.offset);
+      nodesToVisit.push_back(node.offset + 1);
+      continue;
+    }
+    for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+      getTriangle(m_bvhTriangles[i], vertex1, vertex2, vertex3);
+      if (rayIntersectsTriangle(start, direction, vertex1, vertex2, vertex3,
+                                intersection, entryExit)) {
+        intersectionPoints.push_back(intersection);
+        entryExitFlags.push_back(entryExit);
+      }
     }
   }
   // still need to deal with edge cases
@@ -377,6 +532,8 @@ double MeshObject::solidAngle(const Kernel::V3D &observer,
                               const Kernel::V3D &scaleFactor) const
 
 {
+  // Scale the vertices directly rather than constructing a scaled
+  // MeshObject, which would also rebuild the BVH
   std::vector<V3D> scaledVertices;
   scaledVertices.reserve(m_vertices.size());
   for (const auto &vertex : m_vertices) {
@@ -384,8 +541,19 @@ double MeshObject::solidAngle(const Kernel::V3D &observer,
                                 scaleFactor.Y() * vertex.Y(),
                                 scaleFactor.Z() * vertex.Z());
   }
-  MeshObject scaledObject(m_triangles, scaledVertices, m_material);
-  return scaledObject.solidAngle(observer);
+  double solidAngleSum(0), solidAngleNegativeSum(0);
+  for (size_t i = 0; i + 2 < m_triangles.size(); i += 3) {
+    double sa = getTriangleSolidAngle(scaledVertices[m_triangles[i]],
+                                      scaledVertices[m_triangles[i + 1]],
+                                      scaledVertices[m_triangles[i + 2]],
+                                      observer);
+    if (sa > 0.0) {
+      solidAngleSum += sa;
+    } else {
+      solidAngleNegativeSum += sa;
+    }
+  }
+  return 0.5 * (solidAngleSum - solidAngleNegativeSum);
 }
 
 /**
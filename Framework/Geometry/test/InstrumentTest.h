@@ -11,6 +11,7 @@
 #include "MantidKernel/EigenConversionHelpers.h"
 #include "MantidKernel/Exception.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
+#include <algorithm>
 #include <boost/make_shared.hpp>
 #include <cxxtest/TestSuite.h>
 
@@ -703,6 +704,25 @@ public:
                       std::runtime_error &);
   }
 
+  void test_mark_as_detector_finalize_sorts_detector_ids() {
+    Instrument instr;
+    // Enough detectors to make the sort run in parallel
+    const detid_t numberOfDetectors = 10000;
+    for (detid_t id = numberOfDetectors; id > 0; --id) {
+      Detector *d = new Detector("det", (id * 7919) % numberOfDetectors + 1,
+                                 nullptr);
+      instr.add(d);
+      instr.markAsDetectorIncomplete(d);
+    }
+    instr.markAsDetectorFinalize();
+    const auto ids = instr.getDetectorIDs();
+    TS_ASSERT_EQUALS(ids.size(), static_cast<size_t>(numberOfDetectors));
+    TS_ASSERT(std::is_sorted(ids.begin(), ids.end()));
+    TS_ASSERT_EQUALS(ids.front(), 1);
+    TS_ASSERT_EQUALS(ids.back(), numberOfDetectors);
+    TS_ASSERT_EQUALS(instr.getDetector(5000)->getID(), 5000);
+  }
+
 private:
   Instrument_sptr createInstrumentWithSource() {
     using Mantid::Kernel::V3D;
@@ -14,6 +14,7 @@
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ctime>
 #include <cxxtest/TestSuite.h>
@@ -195,6 +196,50 @@ std::unique_ptr<MeshObject> createLShape() {
       std::move(triangles), std::move(vertices), Mantid::Kernel::Material());
   return retVal;
 }
+
+std::unique_ptr<MeshObject> createTessellatedCube(const double size,
+                                                  const int divisions) {
+  /**
+   * Create cube of side length size centred on the origin with each face
+   * split into a divisions x divisions grid of squares, giving many
+   * triangles for exercising the triangle search.
+   */
+  const double half = 0.5 * size;
+  // Centre and in-plane axes of each face, ordered to give outward normals
+  const std::vector<std::array<V3D, 3>> faces = {
+      {{V3D(0, 0, half), V3D(1, 0, 0), V3D(0, 1, 0)}},
+      {{V3D(0, 0, -half), V3D(0, 1, 0), V3D(1, 0, 0)}},
+      {{V3D(half, 0, 0), V3D(0, 1, 0), V3D(0, 0, 1)}},
+      {{V3D(-half, 0, 0), V3D(0, 0, 1), V3D(0, 1, 0)}},
+      {{V3D(0, half, 0), V3D(0, 0, 1), V3D(1, 0, 0)}},
+      {{V3D(0, -half, 0), V3D(1, 0, 0), V3D(0, 0, 1)}}};
+  std::vector<V3D> vertices;
+  std::vector<uint16_t> triangles;
+  for (const auto &face : faces) {
+    const auto base = static_cast<uint16_t>(vertices.size());
+    for (int i = 0; i <= divisions; ++i) {
+      for (int j = 0; j <= divisions; ++j) {
+        vertices.emplace_back(face[0] +
+                              face[1] * (size * i / divisions - half) +
+                              face[2] * (size * j / divisions - half));
+      }
+    }
+    auto index = [base, divisions](int i, int j) {
+      return static_cast<uint16_t>(base + i * (divisions + 1) + j);
+    };
+    for (int i = 0; i < divisions; ++i) {
+      for (int j = 0; j < divisions; ++j) {
+        triangles.insert(triangles.end(),
+                         {index(i, j), index(i + 1, j), index(i + 1, j + 1)});
+        triangles.insert(triangles.end(),
+                         {index(i, j), index(i + 1, j + 1), index(i, j + 1)});
+      }
+    }
+  }
+
+  return Mantid::Kernel::make_unique<MeshObject>(
+      std::move(triangles), std::move(vertices), Mantid::Kernel::Material());
+}
 } // namespace
 
 class MeshObjectTest : public CxxTest::TestSuite {
@@ -901,6 +946,29 @@ public:
     // 4.0 is the volume of the bounding box
   }
 
+  void testIsValidTessellatedCube() {
+    auto geom_obj = createTessellatedCube(2.0, 20);
+    TS_ASSERT_EQUALS(geom_obj->numberOfTriangles(), 4800);
+    TS_ASSERT(geom_obj->isValid(V3D(0, 0, 0)));
+    TS_ASSERT(geom_obj->isValid(V3D(0.99, -0.99, 0.99)));
+    TS_ASSERT(geom_obj->isValid(V3D(0.33, 0.47, -0.81)));
+    TS_ASSERT(geom_obj->isValid(V3D(1.0, 0.5, 0.5)));
+    TS_ASSERT(!geom_obj->isValid(V3D(1.01, 0.5, 0.5)));
+    TS_ASSERT(!geom_obj->isValid(V3D(0.5, -1.01, 0.5)));
+    TS_ASSERT(!geom_obj->isValid(V3D(0.5, 0.5, -1.01)));
+  }
+
+  void testInterceptTessellatedCube() {
+    auto geom_obj = createTessellatedCube(2.0, 20);
+    std::vector<Link> expectedResults;
+    Track track(V3D(-5, 0.013, 0.021), V3D(1, 0, 0));
+
+    // format = startPoint, endPoint, total distance so far
+    expectedResults.emplace_back(Link(V3D(-1, 0.013, 0.021),
+                                      V3D(1, 0.013, 0.021), 6.0, *geom_obj));
+    checkTrackIntercept(std::move(geom_obj), track, expectedResults);
+  }
+
   void testSolidAngleCube()
   /**
   Test solid angle calculation for a cube.
@@ -973,7 +1041,8 @@ public:
 
   MeshObjectTestPerformance()
       : rng(200000), octahedron(createOctahedron()), lShape(createLShape()),
-        smallCube(createCube(0.2)) {
+        smallCube(createCube(0.2)),
+        tessellatedCube(createTessellatedCube(2.0, 100)) {
     testPoints = create_test_points();
     testRays = create_test_rays();
   }
@@ -1009,6 +1078,20 @@ public:
     }
   }
 
+  void test_isValid_many_triangles() {
+    const size_t number(10000);
+    for (size_t i = 0; i < number; ++i) {
+      tessellatedCube->isValid(testPoints[i % testPoints.size()]);
+    }
+  }
+
+  void test_interceptSurface_many_triangles() {
+    const size_t number(10000);
+    for (size_t i = 0; i < number; ++i) {
+      tessellatedCube->interceptSurface(testRays[i % testRays.size()]);
+    }
+  }
+
   void test_solid_angle() {
     const size_t number(10000);
     for (size_t i = 0; i < number; ++i) {
@@ -1120,6 +1203,7 @@ private:
   std::unique_ptr<MeshObject> octahedron;
   std::unique_ptr<MeshObject> lShape;
   std::unique_ptr<MeshObject> smallCube;
+  std::unique_ptr<MeshObject> tessellatedCube;
   std::vector<V3D> testPoints;
   std::vector<Track> testRays;
 };
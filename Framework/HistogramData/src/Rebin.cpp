@@ -13,8 +13,64 @@ using Mantid::HistogramData::Exception::InvalidBinEdgesError;
 using Mantid::HistogramData::Frequencies;
 using Mantid::HistogramData::FrequencyStandardDeviations;
 using Mantid::HistogramData::Histogram;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramX;
+using Mantid::HistogramData::HistogramY;
 
 namespace {
+/** Rebins onto new bin edges that are aligned with the old ones, i.e. every
+ * new bin edge inside the range of the old edges is also an old edge. This is
+ * the case for integer-ratio rebinning of linear or logarithmic grids. Each
+ * old bin then lies fully inside one new bin, so the weighted contents are
+ * summed without computing overlap fractions. Alignment and bin widths are
+ * checked on the fly; as soon as they fail the function gives up, leaving the
+ * general algorithm to deal with the input.
+ * @param xold :: Old bin edges
+ * @param yold :: Old bin contents
+ * @param eold :: Old bin errors
+ * @param xnew :: New bin edges
+ * @param ynew :: Output for the summed contents, zero-initialised
+ * @param enew :: Output for the summed squared errors, zero-initialised
+ * @param weight :: Weight applied to an old bin given its lower and upper edge
+ * @returns true if the grids were aligned and the output is complete
+ */
+template <class Weight>
+bool rebinAligned(const HistogramX &xold, const HistogramY &yold,
+                  const HistogramE &eold, const std::vector<double> &xnew,
+                  HistogramY &ynew, HistogramE &enew, Weight weight) {
+  const size_t size_yold = yold.size();
+  const size_t size_ynew = ynew.size();
+  size_t iold = 0;
+  for (; iold < size_yold && xold[iold + 1] <= xnew[0]; ++iold)
+    if (!(xold[iold] < xold[iold + 1]))
+      return false;
+  if (iold < size_yold && xold[iold] < xnew[0])
+    return false;
+  for (size_t inew = 0; inew < size_ynew && iold < size_yold; ++inew) {
+    const auto xn_high = xnew[inew + 1];
+    if (!(xnew[inew] < xn_high))
+      return false;
+    double y = 0.0;
+    double e = 0.0;
+    for (; iold < size_yold && xold[iold + 1] <= xn_high; ++iold) {
+      const auto xo_low = xold[iold];
+      const auto xo_high = xold[iold + 1];
+      if (!(xo_low < xo_high))
+        return false;
+      const auto w = weight(xo_low, xo_high);
+      const auto ew = eold[iold] * w;
+      y += yold[iold] * w;
+      e += ew * ew;
+    }
+    // An old bin straddling the upper edge means the grids are not aligned
+    if (iold < size_yold && xold[iold] < xn_high)
+      return false;
+    ynew[inew] = y;
+    enew[inew] = e;
+  }
+  return true;
+}
+
 Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
   auto &xold = input.x();
   auto &yold = input.y();
@@ -26,6 +82,13 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
   auto &ynew = newCounts.mutableData();
   auto &enew = newCountVariances.mutableData();
 
+  if (rebinAligned(xold, yold, eold, xnew, ynew, enew,
+                   [](double, double) { return 1.0; }))
+    return Histogram(binEdges, newCounts,
+                     CountStandardDeviations(std::move(newCountVariances)));
+  std::fill(ynew.begin(), ynew.end(), 0.0);
+  std::fill(enew.begin(), enew.end(), 0.0);
+
   auto size_yold = yold.size();
   auto size_ynew = ynew.size();
   size_t iold = 0;
@@ -91,6 +154,18 @@ Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
   size_t iold = 0;
   size_t inew = 0;
 
+  if (rebinAligned(xold, yold, eold, xnew, ynew, enew,
+                   [](const double xo_low, const double xo_high) {
+                     return xo_high - xo_low;
+                   })) {
+    // All old bins are accounted for, only the conversion back to
+    // frequencies below remains
+    iold = size_yold;
+  } else {
+    std::fill(ynew.begin(), ynew.end(), 0.0);
+    std::fill(enew.begin(), enew.end(), 0.0);
+  }
+
   while ((inew < size_ynew) && (iold < size_yold)) {
     auto xo_low = xold[iold];
     auto xo_high = xold[iold + 1];
@@ -380,6 +380,63 @@ public:
     TS_ASSERT_EQUALS(outFreq.e()[2], 0);
   }
 
+  void testCombineAlignedBins() {
+    // Handles the case where every new edge within the input range is also
+    // an input edge, e.g.
+    //    | | | | | | | | | |    becomes:
+    //  |   |     |           |     |
+    auto hist = getCountsHistogram();
+    auto histFreq = getFrequencyHistogram();
+    BinEdges edges{-2, 0, 3, 9, 12};
+
+    auto outCounts = rebin(hist, edges);
+    auto outFreq = rebin(histFreq, edges);
+
+    const std::vector<size_t> first{0, 0, 3, 9};
+    for (size_t i = 0; i < 4; ++i) {
+      double counts = 0.0;
+      double variance = 0.0;
+      for (size_t j = first[i]; j < std::min(size_t(9), first[i + 1]); ++j) {
+        counts += hist.y()[j];
+        variance += hist.e()[j] * hist.e()[j];
+      }
+      const double width = edges[i + 1] - edges[i];
+      TS_ASSERT_DELTA(outCounts.y()[i], counts, 1e-12);
+      TS_ASSERT_DELTA(outCounts.e()[i], std::sqrt(variance), 1e-12);
+      TS_ASSERT_DELTA(outFreq.y()[i], counts / width, 1e-12);
+      TS_ASSERT_DELTA(outFreq.e()[i], std::sqrt(variance) / width, 1e-12);
+    }
+  }
+
+  void testAlignedBinsMatchGeneralRebin() {
+    // Logarithmic input bins rebinned by a factor of three
+    std::vector<double> x{1.0};
+    for (size_t i = 0; i < 30; ++i)
+      x.push_back(x.back() * 1.1);
+    std::vector<double> xAligned;
+    for (size_t i = 0; i < x.size(); i += 3)
+      xAligned.push_back(x[i]);
+    // Moving the edges by a tiny amount forces the general overlap walk
+    auto xShifted = xAligned;
+    for (size_t i = 1; i + 1 < xShifted.size(); ++i)
+      xShifted[i] *= 1.0 + 1e-13;
+
+    Counts counts(30, LinearGenerator(1.0, 0.7));
+    Histogram hist(BinEdges(x), counts, CountStandardDeviations(30, 1.5));
+    Histogram histFreq(BinEdges(x), Frequencies(counts.rawData()),
+                       FrequencyStandardDeviations(30, 1.5));
+
+    for (const auto &input : {hist, histFreq}) {
+      auto aligned = rebin(input, BinEdges(xAligned));
+      auto general = rebin(input, BinEdges(xShifted));
+      TS_ASSERT_EQUALS(aligned.y().size(), 10);
+      for (size_t i = 0; i < aligned.y().size(); ++i) {
+        TS_ASSERT_DELTA(aligned.y()[i], general.y()[i], 1e-9);
+        TS_ASSERT_DELTA(aligned.e()[i], general.e()[i], 1e-9);
+      }
+    }
+  }
+
 private:
   Histogram getCountsHistogram() {
     return Histogram(BinEdges(10, LinearGenerator(0, 1)),
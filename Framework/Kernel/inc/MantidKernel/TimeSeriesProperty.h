@@ -57,10 +57,8 @@ private:
   TYPE mvalue;
 
 public:
-  TimeValueUnit(const Types::Core::DateAndTime &time, TYPE value) {
-    mtime = time;
-    mvalue = value;
-  }
+  TimeValueUnit(const Types::Core::DateAndTime &time, TYPE value)
+      : mtime(time), mvalue(std::move(value)) {}
 
   ~TimeValueUnit() = default;
 
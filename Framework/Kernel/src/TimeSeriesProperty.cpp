@@ -6,6 +6,8 @@
 #include "MantidKernel/make_unique.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <cmath>
+
 #include <boost/regex.hpp>
 
 namespace Mantid {
@@ -769,13 +771,6 @@ void TimeSeriesProperty<TYPE>::makeFilterByValue(
     throw std::invalid_argument(ss.str());
   }
 
-  // If min or max were unset ("empty") in the algorithm, set to the min or max
-  // value of the log
-  if (emptyMin)
-    min = minValue();
-  if (emptyMax)
-    max = maxValue();
-
   // Make sure the splitter starts out empty
   split.clear();
 
@@ -786,9 +781,41 @@ void TimeSeriesProperty<TYPE>::makeFilterByValue(
   // 1. Sort
   sortIfNecessary();
 
+  // If min or max were unset ("empty") in the algorithm, set to the min or max
+  // value of the log. Both extremes are found in a single pass, which also
+  // looks for NaN values as they are never within [min, max].
+  TYPE minEntry = m_values.front().value();
+  TYPE maxEntry = minEntry;
+  bool hasNaN = false;
+  for (const auto &entry : m_values) {
+    const TYPE val = entry.value();
+    if (val < minEntry)
+      minEntry = val;
+    if (maxEntry < val)
+      maxEntry = val;
+    if (std::isnan(static_cast<double>(val)))
+      hasNaN = true;
+  }
+  const double logMin = static_cast<double>(minEntry);
+  const double logMax = static_cast<double>(maxEntry);
+  if (emptyMin)
+    min = logMin;
+  if (emptyMax)
+    max = logMax;
+
+  time_duration tol = DateAndTime::durationFromSeconds(TimeTolerance);
+
+  // If every value lies within [min, max] the whole log is a single good
+  // section and there is no need to walk the values
+  if (!hasNaN && logMin >= min && logMax <= max) {
+    const DateAndTime first = m_values.front().time();
+    split.emplace_back(centre ? first - tol : first,
+                       m_values.back().time() + tol, 0);
+    return;
+  }
+
   // 2. Do the rest
   bool lastGood(false);
-  time_duration tol = DateAndTime::durationFromSeconds(TimeTolerance);
   int numgood = 0;
   DateAndTime t;
   DateAndTime start, stop;
@@ -947,15 +974,32 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
 
   sortIfNecessary();
 
+  const auto timeLess = [](const TimeValueUnit<TYPE> &entry,
+                           const DateAndTime &t) { return entry.time() < t; };
   double numerator(0.0), totalTime(0.0);
+  // The filter ranges are normally in time order, so the search for the
+  // start of each range only needs to look at the entries after the last one
+  auto searchStart = m_values.cbegin();
   // Loop through the filter ranges
   for (const auto &time : filter) {
     // Calculate the total time duration (in seconds) within by the filter
     totalTime += time.duration();
 
-    // Get the log value and index at the start time of the filter
+    // Get the log value and index at the start time of the filter: the last
+    // entry at or before it, or the first entry if it precedes the log
+    if (time.start() < searchStart->time())
+      searchStart = m_values.cbegin();
     int index;
-    double value = getSingleValue(time.start(), index);
+    if (time.start() >= m_values.back().time()) {
+      index = realSize() - 1;
+    } else {
+      auto fid = std::lower_bound(searchStart, m_values.cend(), time.start(),
+                                  timeLess);
+      index = static_cast<int>(fid - m_values.cbegin());
+      if (index > 0 && fid->time() > time.start())
+        --index;
+    }
+    double value = static_cast<double>(m_values[index].value());
     DateAndTime startTime = time.start();
 
     while (index < realSize() - 1 && m_values[index + 1].time() < time.stop()) {
@@ -970,6 +1014,7 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
     // Now close off with the end of the current filter range
     numerator +=
         DateAndTime::secondsFromDuration(time.stop() - startTime) * value;
+    searchStart = m_values.cbegin() + index;
   }
 
   // 'Normalise' by the total time
@@ -1158,9 +1203,12 @@ std::vector<double> TimeSeriesProperty<TYPE>::timesAsVectorSeconds() const {
   std::vector<double> out;
   out.reserve(m_values.size());
 
-  Types::Core::DateAndTime start = m_values[0].time();
+  // Subtract the times as nanoseconds rather than boost time durations
+  const int64_t start = m_values[0].time().totalNanoseconds();
   for (size_t i = 0; i < m_values.size(); i++) {
-    out.push_back(DateAndTime::secondsFromDuration(m_values[i].time() - start));
+    out.push_back(
+        static_cast<double>(m_values[i].time().totalNanoseconds() - start) /
+        1e9);
   }
 
   return out;
@@ -1492,11 +1540,28 @@ void TimeSeriesProperty<TYPE>::create(
     throw std::invalid_argument("TimeSeriesProperty::create: mismatched size "
                                 "for the time and values vectors.");
 
-  // Make the times(as seconds) into a vector of DateAndTime in one go.
-  std::vector<DateAndTime> times;
-  DateAndTime::createVector(start_time, time_sec, times);
+  clear();
+  m_values.reserve(time_sec.size());
 
-  this->create(times, new_values);
+  // Convert the offsets to absolute times while filling the entries, in the
+  // same way as DateAndTime::createVector, so no temporary vector of times is
+  // needed.
+  const int64_t startNano = start_time.totalNanoseconds();
+  int64_t previousNano = startNano;
+  m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
+  for (std::size_t i = 0; i < time_sec.size(); i++) {
+    const int64_t nano =
+        startNano + static_cast<int64_t>(time_sec[i] * 1000000000.0);
+    m_values.emplace_back(DateAndTime(nano), new_values[i]);
+    if (i > 0 && previousNano > nano) {
+      // Status gets to unsorted
+      m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
+    }
+    previousNano = nano;
+  }
+
+  // reset the size
+  m_size = static_cast<int>(m_values.size());
 }
 
 //--------------------------------------------------------------------------------------------
@@ -1522,8 +1587,7 @@ void TimeSeriesProperty<TYPE>::create(
 
   m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   for (std::size_t i = 0; i < num; i++) {
-    TimeValueUnit<TYPE> newentry(new_times[i], new_values[i]);
-    m_values.push_back(newentry);
+    m_values.emplace_back(new_times[i], new_values[i]);
     if (m_propSortedFlag == TimeSeriesSortStatus::TSSORTED && i > 0 &&
         new_times[i - 1] > new_times[i]) {
       // Status gets to unsorted
@@ -2119,10 +2183,11 @@ int TimeSeriesProperty<TYPE>::findIndex(Types::Core::DateAndTime t) const {
     return (int(m_values.size()));
   }
 
-  // 3. Find by lower_bound()
-  typename std::vector<TimeValueUnit<TYPE>>::const_iterator fid;
-  TimeValueUnit<TYPE> temp(t, m_values[0].value());
-  fid = std::lower_bound(m_values.begin(), m_values.end(), temp);
+  // 3. Find by lower_bound() on the times only, so that no value is copied
+  auto fid = std::lower_bound(
+      m_values.cbegin(), m_values.cend(), t,
+      [](const TimeValueUnit<TYPE> &entry,
+         const Types::Core::DateAndTime &time) { return entry.time() < time; });
 
   int newindex = int(fid - m_values.begin());
   if (fid->time() > t)
@@ -1,6 +1,7 @@
 #ifndef TIMESERIESPROPERTYTEST_H_
 #define TIMESERIESPROPERTYTEST_H_
 
+#include "MantidKernel/EmptyValues.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/TimeSeriesProperty.h"
@@ -8,6 +9,7 @@
 #include "MantidKernel/make_unique.h"
 #include <cxxtest/TestSuite.h>
 
+#include <algorithm>
 #include <boost/make_shared.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
@@ -15,6 +17,7 @@
 #include <vector>
 
 using namespace Mantid::Kernel;
+using Mantid::EMPTY_DBL;
 using Mantid::Types::Core::DateAndTime;
 
 class TimeSeriesPropertyTest : public CxxTest::TestSuite {
@@ -460,6 +463,56 @@ public:
     delete log;
   }
 
+  void test_makeFilterByValue_with_all_values_in_range() {
+    TimeSeriesProperty<int> log("MyIntLog");
+    log.addValue("2007-11-30T16:17:20", 3);
+    log.addValue("2007-11-30T16:17:00", 1);
+    log.addValue("2007-11-30T16:17:10", 2);
+
+    TimeSplitterType splitter;
+    log.makeFilterByValue(splitter, EMPTY_DBL(), EMPTY_DBL(), 1.0, true);
+    TS_ASSERT_EQUALS(splitter.size(), 1);
+    TS_ASSERT_DELTA(splitter[0].start(), DateAndTime("2007-11-30T16:16:59"),
+                    1e-3);
+    TS_ASSERT_DELTA(splitter[0].stop(), DateAndTime("2007-11-30T16:17:21"),
+                    1e-3);
+
+    log.makeFilterByValue(splitter, 0.0, EMPTY_DBL(), 1.0);
+    TS_ASSERT_EQUALS(splitter.size(), 1);
+    TS_ASSERT_DELTA(splitter[0].start(), DateAndTime("2007-11-30T16:17:00"),
+                    1e-3);
+    TS_ASSERT_DELTA(splitter[0].stop(), DateAndTime("2007-11-30T16:17:21"),
+                    1e-3);
+
+    // Only the first value is good when the maximum is below the others
+    log.makeFilterByValue(splitter, EMPTY_DBL(), 1.5, 0.0);
+    TS_ASSERT_EQUALS(splitter.size(), 1);
+    TS_ASSERT_DELTA(splitter[0].start(), DateAndTime("2007-11-30T16:17:00"),
+                    1e-3);
+    TS_ASSERT_DELTA(splitter[0].stop(), DateAndTime("2007-11-30T16:17:10"),
+                    1e-3);
+  }
+
+  void test_makeFilterByValue_with_nan_in_range_of_values() {
+    TimeSeriesProperty<double> log("MyDoubleLog");
+    log.addValue("2007-11-30T16:17:00", 1.0);
+    log.addValue("2007-11-30T16:17:10", std::nan(""));
+    log.addValue("2007-11-30T16:17:20", 3.0);
+
+    // The NaN entry is bad, so the log is not a single good section
+    TimeSplitterType splitter;
+    log.makeFilterByValue(splitter, EMPTY_DBL(), EMPTY_DBL(), 1.0, true);
+    TS_ASSERT_EQUALS(splitter.size(), 2);
+    TS_ASSERT_DELTA(splitter[0].start(), DateAndTime("2007-11-30T16:16:59"),
+                    1e-3);
+    TS_ASSERT_DELTA(splitter[0].stop(), DateAndTime("2007-11-30T16:17:01"),
+                    1e-3);
+    TS_ASSERT_DELTA(splitter[1].start(), DateAndTime("2007-11-30T16:17:19"),
+                    1e-3);
+    TS_ASSERT_DELTA(splitter[1].stop(), DateAndTime("2007-11-30T16:17:21"),
+                    1e-3);
+  }
+
   void test_makeFilterByValue_throws_for_string_property() {
     TimeSeriesProperty<std::string> log("StringTSP");
     TimeSplitterType splitter;
@@ -1494,6 +1547,25 @@ public:
     return;
   }
 
+  void test_create_from_unsorted_time_offsets() {
+    const Mantid::Types::Core::DateAndTime start("2007-11-30T16:17:00");
+    const std::vector<double> offsets{0.5, 30.25, 10.0, 20.0};
+    const std::vector<std::string> values{"a", "d", "b", "c"};
+    TimeSeriesProperty<std::string> log("stringProp");
+    log.create(start, offsets, values);
+
+    std::vector<Mantid::Types::Core::DateAndTime> expectedTimes;
+    Mantid::Types::Core::DateAndTime::createVector(start, offsets,
+                                                   expectedTimes);
+    std::sort(expectedTimes.begin(), expectedTimes.end());
+    TS_ASSERT_EQUALS(log.size(), 4);
+    TS_ASSERT_EQUALS(log.timesAsVector(), expectedTimes);
+    const std::vector<std::string> sortedValues{"a", "b", "c", "d"};
+    TS_ASSERT_EQUALS(log.valuesAsVector(), sortedValues);
+    TS_ASSERT_EQUALS(log.firstValue(), "a");
+    TS_ASSERT_EQUALS(log.lastValue(), "d");
+  }
+
   /*
    * Test time_tValue()
    */
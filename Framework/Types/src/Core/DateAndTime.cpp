@@ -2,6 +2,8 @@
 
 #include "MantidTypes/Core/DateAndTimeHelpers.h"
 
+#include <cstdio>
+
 namespace Mantid {
 namespace Types {
 namespace Core {
@@ -48,6 +50,190 @@ std::tm *gmtime_r_portable(const std::time_t *clock, struct std::tm *result) {
   return gmtime_r(clock, result);
 #endif
 }
+
+/// Number of seconds in one day
+const int64_t SECONDS_PER_DAY = 86400;
+
+/// Number of days from 1970-01-01 to the GPS epoch, 1990-01-01
+const int64_t GPS_EPOCH_DAYS = 7305;
+
+/// Abbreviated month names, as written by boost::posix_time
+const char *const MONTH_NAMES[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                   "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+/** Number of days from 1970-01-01 to a date in the Gregorian calendar
+ * @param year :: year
+ * @param month :: month, from 1 to 12
+ * @param day :: day of the month, from 1
+ * @return the number of days, negative for earlier dates
+ */
+int64_t daysFromCivil(int64_t year, const int64_t month, const int64_t day) {
+  year -= month <= 2;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t yearOfEra = year - era * 400;
+  const int64_t dayOfYear =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const int64_t dayOfEra =
+      yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+/** Date in the Gregorian calendar a number of days after 1970-01-01
+ * @param days :: number of days, negative for earlier dates
+ * @param year :: set to the year
+ * @param month :: set to the month, from 1 to 12
+ * @param day :: set to the day of the month, from 1
+ */
+void civilFromDays(int64_t days, int64_t &year, int64_t &month,
+                   int64_t &day) {
+  days += 719468;
+  const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const int64_t dayOfEra = days - era * 146097;
+  const int64_t yearOfEra =
+      (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) /
+      365;
+  const int64_t dayOfYear =
+      dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const int64_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+  day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+  month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+  year = yearOfEra + era * 400 + (month <= 2);
+}
+
+/** Read a fixed number of decimal digits, advancing the position past them
+ * @param pos :: position in a null-terminated string
+ * @param count :: number of digits to read
+ * @param value :: set to the value of the digits
+ * @return true if there were enough digits
+ */
+bool readDigits(const char *&pos, const int count, int64_t &value) {
+  value = 0;
+  for (int i = 0; i < count; ++i, ++pos) {
+    if (*pos < '0' || *pos > '9')
+      return false;
+    value = value * 10 + (*pos - '0');
+  }
+  return true;
+}
+
+/** Convert a string in the common extended ISO8601 format
+ * "yyyy-mm-ddThh:mm:ss[.fffffffff][Z|+hh[:mm]|-hh[:mm]]" (or with a space in
+ * place of the T and no time zone) to nanoseconds since the GPS epoch,
+ * without going through boost::posix_time.
+ * @param str :: the string to convert
+ * @param nanoseconds :: set to the time, if the string could be converted
+ * @return false if the string is not in this format or is out of the range
+ * handled here, in which case it must go through the general conversion
+ */
+bool parseExtendedISO8601(const std::string &str, int64_t &nanoseconds) {
+  const char *pos = str.c_str();
+  const char *const end = pos + str.size();
+  int64_t year, month, day, hour, minute, second;
+  if (!readDigits(pos, 4, year) || *pos++ != '-' ||
+      !readDigits(pos, 2, month) || *pos++ != '-' || !readDigits(pos, 2, day))
+    return false;
+  const char separator = *pos++;
+  if ((separator != 'T' && separator != ' ') || !readDigits(pos, 2, hour) ||
+      *pos++ != ':' || !readDigits(pos, 2, minute) || *pos++ != ':' ||
+      !readDigits(pos, 2, second))
+    return false;
+
+  // Fractional seconds, to nanosecond resolution
+  int64_t fraction = 0;
+  if (*pos == '.') {
+    ++pos;
+    int digits = 0;
+    for (; *pos >= '0' && *pos <= '9'; ++pos, ++digits) {
+      if (digits == 9)
+        return false;
+      fraction = fraction * 10 + (*pos - '0');
+    }
+    if (digits == 0)
+      return false;
+    for (; digits < 9; ++digits)
+      fraction *= 10;
+  }
+
+  // Time zone, only allowed after a T as in the general conversion
+  int64_t offset = 0;
+  if (separator == 'T') {
+    if (*pos == 'Z') {
+      ++pos;
+    } else if (*pos == '+' || *pos == '-') {
+      const int64_t sign = *pos++ == '+' ? 1 : -1;
+      int64_t offsetHours, offsetMinutes = 0;
+      if (!readDigits(pos, 2, offsetHours))
+        return false;
+      if (*pos == ':' && !readDigits(++pos, 2, offsetMinutes))
+        return false;
+      if (offsetHours > 23 || offsetMinutes > 59)
+        return false;
+      offset = sign * (offsetHours * 3600 + offsetMinutes * 60);
+    }
+  }
+  if (pos != end)
+    return false;
+
+  // Leave invalid dates and times, and times near the limits of DateAndTime,
+  // to the general conversion
+  if (year < 1900 || year > 2100 || month < 1 || month > 12 || day < 1 ||
+      hour > 23 || minute > 59 || second > 59)
+    return false;
+  const int64_t days = daysFromCivil(year, month, day);
+  int64_t checkYear, checkMonth, checkDay;
+  civilFromDays(days, checkYear, checkMonth, checkDay);
+  if (checkMonth != month || checkDay != day)
+    return false;
+
+  const int64_t seconds = (days - GPS_EPOCH_DAYS) * SECONDS_PER_DAY +
+                          hour * 3600 + minute * 60 + second - offset;
+  nanoseconds = seconds * NANO_PER_SEC + fraction;
+  return true;
+}
+
+/** Write a time as a string in the formats of boost::posix_time's
+ * to_iso_extended_string or to_simple_string
+ * @param nanoseconds :: nanoseconds since the GPS epoch
+ * @param iso :: true for ISO8601 "yyyy-mm-ddThh:mm:ss", false for
+ * "yyyy-Mmm-dd hh:mm:ss". Fractional seconds are added if not zero.
+ * @return the formatted time
+ */
+std::string formatTime(const int64_t nanoseconds, const bool iso) {
+  int64_t seconds = nanoseconds / NANO_PER_SEC;
+  int64_t fraction = nanoseconds % NANO_PER_SEC;
+  if (fraction < 0) {
+    fraction += NANO_PER_SEC;
+    --seconds;
+  }
+  int64_t days = seconds / SECONDS_PER_DAY;
+  int64_t secondOfDay = seconds % SECONDS_PER_DAY;
+  if (secondOfDay < 0) {
+    secondOfDay += SECONDS_PER_DAY;
+    --days;
+  }
+  int64_t year, month, day;
+  civilFromDays(days + GPS_EPOCH_DAYS, year, month, day);
+  const int hour = static_cast<int>(secondOfDay / 3600);
+  const int minute = static_cast<int>(secondOfDay / 60 % 60);
+  const int second = static_cast<int>(secondOfDay % 60);
+
+  char buffer[40];
+  int length;
+  if (iso)
+    length = std::snprintf(buffer, sizeof(buffer),
+                           "%04d-%02d-%02dT%02d:%02d:%02d",
+                           static_cast<int>(year), static_cast<int>(month),
+                           static_cast<int>(day), hour, minute, second);
+  else
+    length = std::snprintf(buffer, sizeof(buffer),
+                           "%04d-%s-%02d %02d:%02d:%02d",
+                           static_cast<int>(year), MONTH_NAMES[month - 1],
+                           static_cast<int>(day), hour, minute, second);
+  if (fraction != 0)
+    length += std::snprintf(buffer + length, sizeof(buffer) - length, ".%09d",
+                            static_cast<int>(fraction));
+  return std::string(buffer, static_cast<size_t>(length));
+}
 } // namespace
 
 //-----------------------------------------------------------------------------------------------
@@ -343,6 +529,13 @@ const DateAndTime &DateAndTime::defaultTime() {
  *               "yyyy-mm-ddThh:mm:ss[Z+-]tz:tz" or "yyy-MMM-dd hh:mm:ss.ssss"
  */
 void DateAndTime::setFromISO8601(const std::string &str) {
+  // Most strings are in the extended ISO8601 format, which is read directly
+  int64_t nanoseconds;
+  if (parseExtendedISO8601(str, nanoseconds)) {
+    _nanoseconds = nanoseconds;
+    return;
+  }
+
   if (!DateAndTimeHelpers::stringIsISO8601(str) &&
       !DateAndTimeHelpers::stringIsPosix(str)) {
     throw std::invalid_argument("Error interpreting string '" + str +
@@ -443,7 +636,7 @@ void DateAndTime::setFromISO8601(const std::string &str) {
  * @return date-time formatted as a simple string
  */
 std::string DateAndTime::toSimpleString() const {
-  return boost::posix_time::to_simple_string(this->to_ptime());
+  return formatTime(_nanoseconds, false);
 }
 
 //------------------------------------------------------------------------------------------------
@@ -464,7 +657,7 @@ std::string DateAndTime::toFormattedString(const std::string format) const {
  *  @return The ISO8601 string
  */
 std::string DateAndTime::toISO8601String() const {
-  return boost::posix_time::to_iso_extended_string(to_ptime());
+  return formatTime(_nanoseconds, true);
 }
 
 //------------------------------------------------------------------------------------------------
@@ -15,10 +15,11 @@ bool stringIsISO8601(const std::string &date) {
   // Expecting most of Mantid's time stamp strings to be in the
   // extended format --- check it first.
   // On Ubuntu 14.04, std::regex seems to be broken, thus boost.
-  const boost::regex extendedFormat(
+  // The expressions are compiled once, on first use.
+  static const boost::regex extendedFormat(
       R"(^\d{4}-[01]\d-[0-3]\d([T\s][0-2]\d:[0-5]\d(:\d{2})?(.\d+)?(Z|[+-]\d{2}(:?\d{2})?)?)?$)");
   if (!boost::regex_match(date, extendedFormat)) {
-    const boost::regex basicFormat(
+    static const boost::regex basicFormat(
         R"(^\d{4}[01]\d[0-3]\d([T\s][0-2]\d[0-5]\d(\d{2})?(.\d+)?(Z|[+-]\d{2}(:?\d{2})?)?)?$)");
     return boost::regex_match(date, basicFormat);
   }
@@ -32,7 +33,7 @@ bool stringIsISO8601(const std::string &date) {
  */
 bool stringIsPosix(const std::string &date) {
   // Formatting taken from boost::to_simple_string.
-  const boost::regex format(
+  static const boost::regex format(
       R"(^\d{4}-[A-Z][a-z]{2}-[0-3]\d\s[0-2]\d:[0-5]\d:\d{2}(.\d+)?$)");
   return boost::regex_match(date, format);
 }
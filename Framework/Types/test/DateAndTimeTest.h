@@ -380,6 +380,38 @@ public:
         1e-4);
   }
 
+  void test_string_conversions_match_boost() {
+    const std::vector<int64_t> times{0,
+                                     1,
+                                     -1,
+                                     123456789,
+                                     86399999999999,
+                                     -86400000000000,
+                                     638007132000000000,
+                                     -630000000000000001,
+                                     DateAndTime::maximum().totalNanoseconds(),
+                                     DateAndTime::minimum().totalNanoseconds()};
+    for (const auto nanoseconds : times) {
+      const DateAndTime time(nanoseconds);
+      const auto asPtime = time.to_ptime();
+      TS_ASSERT_EQUALS(time.toISO8601String(),
+                       boost::posix_time::to_iso_extended_string(asPtime));
+      TS_ASSERT_EQUALS(time.toSimpleString(),
+                       boost::posix_time::to_simple_string(asPtime));
+      TS_ASSERT_EQUALS(DateAndTime(time.toISO8601String()), time);
+    }
+  }
+
+  void test_strings_in_other_formats_are_still_read() {
+    const DateAndTime expected("2010-03-24T14:12:51");
+    TS_ASSERT_EQUALS(DateAndTime("2010-03-24 14:12:51"), expected);
+    TS_ASSERT_EQUALS(DateAndTime("2010-Mar-24 14:12:51"), expected);
+    TS_ASSERT_EQUALS(DateAndTime("2010-03-24T14:12"),
+                     DateAndTime("2010-03-24T14:12:00"));
+    TS_ASSERT_THROWS(DateAndTime("2010-02-30T14:12:51"),
+                     std::invalid_argument);
+  }
+
   void testDurations() {
     time_duration onesec = time_duration(0, 0, 1, 0);
     TS_ASSERT_EQUALS(DateAndTime::secondsFromDuration(onesec), 1.0);